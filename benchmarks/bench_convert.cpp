@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/**
+ * @file bench_convert.cpp
+ * @brief Throughput of the bulk conversion kernels against the scalar loop.
+ *
+ * For each buffer size (L1-resident, L2-resident and memory-bound) every
+ * SIMD tier supported by the CPU is timed against the scalar kernel, followed
+ * by the end-to-end convert_batch() entry point.
+ *
+ * Build with `-DQTTY_BUILD_BENCHMARKS=ON` and run `./bench_convert`.
+ */
+
+#include "qtty/qtty.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace qtty;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Best-of-N wall time per element, in nanoseconds.
+template <typename Fn> double time_per_element(std::size_t count, Fn &&fn) {
+  const std::size_t min_elements = std::size_t(1) << 26;
+  const std::size_t reps = std::max<std::size_t>(1, min_elements / count);
+  double best = 1e300;
+  for (int trial = 0; trial < 5; ++trial) {
+    const auto start = Clock::now();
+    for (std::size_t r = 0; r < reps; ++r) {
+      fn();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    best = std::min(best, elapsed.count() / static_cast<double>(reps * count));
+  }
+  return best;
+}
+
+// Keeps the optimizer from discarding the converted buffers.
+template <typename T> void consume(const std::vector<T> &values) {
+  volatile T sink = values[values.size() / 2];
+  (void)sink;
+}
+
+void run_scale(const simd::KernelTable &table, const double *in, double *out, std::size_t count,
+               double factor) {
+  table.scale_f64(in, out, count, factor);
+}
+
+void run_scale(const simd::KernelTable &table, const float *in, float *out, std::size_t count,
+               float factor) {
+  table.scale_f32(in, out, count, factor);
+}
+
+template <typename T> void bench_size(std::size_t count) {
+  std::vector<T> in(count);
+  std::vector<T> out(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    in[i] = static_cast<T>(i % 1000) * static_cast<T>(0.25);
+  }
+  const char *type = sizeof(T) == 8 ? "f64" : "f32";
+
+  const simd::KernelTable scalar = simd::kernel_table(simd::SimdLevel::Scalar);
+  const double scalar_ns = time_per_element(
+      count, [&] { run_scale(scalar, in.data(), out.data(), count, static_cast<T>(1e-3)); });
+  consume(out);
+  std::printf("%-4s %9zu  %-8s %8.3f ns/elem  %6.2fx\n", type, count, "scalar", scalar_ns, 1.0);
+
+  for (int level = 1; level <= static_cast<int>(simd::detect_level()); ++level) {
+    const simd::KernelTable table = simd::kernel_table(static_cast<simd::SimdLevel>(level));
+    const double ns = time_per_element(
+        count, [&] { run_scale(table, in.data(), out.data(), count, static_cast<T>(1e-3)); });
+    consume(out);
+    std::printf("%-4s %9zu  %-8s %8.3f ns/elem  %6.2fx\n", type, count,
+                simd::to_string(table.level), ns, scalar_ns / ns);
+  }
+
+  const double batch_ns = time_per_element(
+      count, [&] { convert_batch<Meter, Kilometer>(in.data(), out.data(), count); });
+  consume(out);
+  std::printf("%-4s %9zu  %-8s %8.3f ns/elem  %6.2fx\n\n", type, count, "batch", batch_ns,
+              scalar_ns / batch_ns);
+}
+
+} // namespace
+
+int main() {
+  std::printf("qtty bulk conversion benchmark (active kernels: %s)\n\n",
+              simd::to_string(simd::active_level()));
+  std::printf("type     count  kernel       time          speedup vs scalar\n");
+  for (std::size_t count : {std::size_t(1) << 10, std::size_t(1) << 16, std::size_t(1) << 22}) {
+    bench_size<double>(count);
+    bench_size<float>(count);
+  }
+  return 0;
+}
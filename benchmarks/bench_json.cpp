@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/**
+ * @file bench_json.cpp
+ * @brief Throughput of JSON quantity fields read in place from one buffer.
+ *
+ * Writes N `{"value","unit_id"}` objects back to back into one contiguous
+ * buffer (as a network receive buffer would hold them), then parses every
+ * field with the `(pointer, length)` entry point and, for comparison, after
+ * copying it into a `std::string` first. Half of the fields are stored in
+ * kilometers, so they are converted while parsing into meters.
+ *
+ * Build with `-DQTTY_BUILD_BENCHMARKS=ON` in Release mode (debug builds
+ * cross-check each field against qtty-ffi) and run `./bench_json [fields]`
+ * (default 10^6).
+ */
+
+#include "qtty/qtty.hpp"
+#include "qtty/serialization.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace qtty;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Best-of-N wall time, in milliseconds.
+template <typename Fn> double time_ms(Fn &&fn) {
+  double best = 1e300;
+  for (int trial = 0; trial < 5; ++trial) {
+    const auto start = Clock::now();
+    fn();
+    const std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+    best = std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+struct Field {
+  std::size_t offset;
+  std::size_t length;
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+  std::vector<char> buffer(count * serialization::kMaxJsonSize);
+  std::vector<Field> fields(count);
+  std::size_t used = 0;
+  const double write = time_ms([&] {
+    used = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      const double value = 0.001 * static_cast<double>(i) + 0.5;
+      char *out = buffer.data() + used;
+      const std::size_t length =
+          i % 2 ? serialization::to_json(Kilometer(value), out, serialization::kMaxJsonSize)
+                : serialization::to_json(Meter(value), out, serialization::kMaxJsonSize);
+      fields[i] = {used, length};
+      used += length;
+    }
+  });
+
+  double checksum = 0.0;
+  const double in_place = time_ms([&] {
+    checksum = 0.0;
+    for (const Field &field : fields) {
+      checksum += serialization::from_json<Meter>(buffer.data() + field.offset, field.length)
+                      .value();
+    }
+  });
+
+  double copied_checksum = 0.0;
+  const double copied = time_ms([&] {
+    copied_checksum = 0.0;
+    for (const Field &field : fields) {
+      const std::string copy(buffer.data() + field.offset, field.length);
+      copied_checksum += serialization::from_json<Meter>(copy).value();
+    }
+  });
+
+  std::printf("qtty JSON benchmark (%zu fields, %.1f MB)\n\n", count, used / 1e6);
+  std::printf("write into buffer     %8.2f ms  %7.1f Mfields/s\n", write, count / write / 1e3);
+  std::printf("parse in place        %8.2f ms  %7.1f Mfields/s\n", in_place,
+              count / in_place / 1e3);
+  std::printf("parse std::string     %8.2f ms  %7.1f Mfields/s\n", copied, count / copied / 1e3);
+  std::printf("\nchecksums agree: %s\n", checksum == copied_checksum ? "yes" : "NO");
+  return checksum == copied_checksum ? 0 : 1;
+}
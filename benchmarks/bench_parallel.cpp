@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/**
+ * @file bench_parallel.cpp
+ * @brief Thread scaling of the parallel bulk operations.
+ *
+ * Times batch conversion, a fused array expression and a sum over one large
+ * array with 1, 2, 4, ... threads up to the hardware concurrency, and checks
+ * that the sum is bitwise identical for every thread count.
+ *
+ * Build with `-DQTTY_BUILD_BENCHMARKS=ON` and run
+ * `./bench_parallel [elements]` (default 2^25).
+ */
+
+#include "qtty/qtty.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace qtty;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Best-of-N wall time, in milliseconds.
+template <typename Fn> double time_ms(Fn &&fn) {
+  double best = 1e300;
+  for (int trial = 0; trial < 5; ++trial) {
+    const auto start = Clock::now();
+    fn();
+    const std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+    best = std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+std::vector<unsigned> thread_counts() {
+  const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<unsigned> counts;
+  for (unsigned t = 1; t < hardware; t *= 2) {
+    counts.push_back(t);
+  }
+  counts.push_back(hardware);
+  return counts;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t count =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (std::size_t(1) << 25);
+
+  QuantityArray<KilometerTag> km(count);
+  QuantityArray<SecondTag> s(count, Second(3.0));
+  for (std::size_t i = 0; i < count; ++i) {
+    km.set(i, Kilometer(static_cast<double>(i % 1000) * 0.25));
+  }
+  QuantityArray<MeterTag> m(count);
+  QuantityArray<CompoundTag<KilometerTag, SecondTag>> speed(count);
+
+  std::printf("qtty parallel scaling benchmark (%zu elements)\n\n", count);
+  std::printf("threads  convert ms  speedup  expr ms  speedup  sum ms  speedup\n");
+
+  double base_convert = 0.0;
+  double base_expr = 0.0;
+  double base_sum = 0.0;
+  double reference_sum = 0.0;
+  bool deterministic = true;
+  for (unsigned threads : thread_counts()) {
+    const execution::parallel_policy policy{threads};
+    const double convert = time_ms([&] { convert_batch(policy, km.span(), m.span()); });
+    const double expr = time_ms([&] { evaluate(policy, km / s, speed.span()); });
+    double total = 0.0;
+    const double reduce = time_ms([&] { total = sum(policy, km.span()).value(); });
+
+    if (threads == 1) {
+      base_convert = convert;
+      base_expr = expr;
+      base_sum = reduce;
+      reference_sum = total;
+    }
+    deterministic = deterministic && total == reference_sum;
+    std::printf("%7u  %10.2f  %6.2fx  %7.2f  %6.2fx  %6.2f  %6.2fx\n", threads, convert,
+                base_convert / convert, expr, base_expr / expr, reduce, base_sum / reduce);
+  }
+  std::printf("\nsum bitwise identical across thread counts: %s\n", deterministic ? "yes" : "NO");
+  return deterministic ? 0 : 1;
+}
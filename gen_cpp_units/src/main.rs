@@ -34,43 +34,125 @@ const LICENSE: &str = "// SPDX-License-Identifier: BSD-3-Clause\n\
                         // Copyright (C) 2026 Vallés Puig, Ramon\n";
 const COLUMN_LIMIT: usize = 100;
 
-/// Dimension name → (output file name, discriminant leading code).
-const DIMENSIONS: &[(&str, &str, u32)] = &[
-    ("Length", "length.hpp", 1),
-    ("Time", "time.hpp", 2),
-    ("Angle", "angular.hpp", 3),
-    ("Mass", "mass.hpp", 4),
-    ("Power", "power.hpp", 5),
-    ("Area", "area.hpp", 6),
-    ("Volume", "volume.hpp", 7),
-    ("Acceleration", "acceleration.hpp", 8),
-    ("Force", "force.hpp", 9),
-    ("Energy", "energy.hpp", 10),
-    ("Pressure", "pressure.hpp", 11),
-    ("SolidAngle", "solid_angle.hpp", 12),
-    ("Temperature", "temperature.hpp", 13),
-    ("Radiance", "radiance.hpp", 14),
-    ("SpectralRadiance", "spectral_radiance.hpp", 15),
-    ("PhotonRadiance", "photon_radiance.hpp", 16),
-    ("SpectralPhotonRadiance", "spectral_photon_radiance.hpp", 17),
-    ("InverseSolidAngle", "inverse_solid_angle.hpp", 18),
-    ("LuminousIntensity", "luminous_intensity.hpp", 19),
-    ("LuminousFlux", "luminous_flux.hpp", 20),
-    ("Illuminance", "illuminance.hpp", 21),
-    ("Frequency", "frequency.hpp", 22),
-    ("AmountOfSubstance", "amount.hpp", 23),
-    ("Current", "current.hpp", 24),
-    ("Charge", "charge.hpp", 25),
-    ("Voltage", "voltage.hpp", 26),
-    ("Resistance", "resistance.hpp", 27),
-    ("Capacitance", "capacitance.hpp", 28),
-    ("Inductance", "inductance.hpp", 29),
-    ("MagneticFlux", "magnetic_flux.hpp", 30),
-    ("MagneticFluxDensity", "magnetic_flux_density.hpp", 31),
-    ("Density", "density.hpp", 32),
-    ("Dimensionless", "dimensionless.hpp", 33),
+/// Dimension name → (output file name, discriminant leading code, SI reference unit).
+///
+/// The reference unit is the coherent SI unit of the dimension: every generated
+/// `to_si_factor()` is the value of one unit expressed in that reference unit.
+/// Dimensions whose CSV has no coherent SI unit (`InverseSolidAngle` only has
+/// `S10`, stars per square degree) get `None` and convert through the FFI.
+const DIMENSIONS: &[(&str, &str, u32, Option<&str>)] = &[
+    ("Length", "length.hpp", 1, Some("Meter")),
+    ("Time", "time.hpp", 2, Some("Second")),
+    ("Angle", "angular.hpp", 3, Some("Radian")),
+    ("Mass", "mass.hpp", 4, Some("Kilogram")),
+    ("Power", "power.hpp", 5, Some("Watt")),
+    ("Area", "area.hpp", 6, Some("SquareMeter")),
+    ("Volume", "volume.hpp", 7, Some("CubicMeter")),
+    (
+        "Acceleration",
+        "acceleration.hpp",
+        8,
+        Some("MeterPerSecondSquared"),
+    ),
+    ("Force", "force.hpp", 9, Some("Newton")),
+    ("Energy", "energy.hpp", 10, Some("Joule")),
+    ("Pressure", "pressure.hpp", 11, Some("Pascal")),
+    ("SolidAngle", "solid_angle.hpp", 12, Some("Steradian")),
+    ("Temperature", "temperature.hpp", 13, Some("Kelvin")),
+    (
+        "Radiance",
+        "radiance.hpp",
+        14,
+        Some("WattPerSquareMeterSteradian"),
+    ),
+    (
+        "SpectralRadiance",
+        "spectral_radiance.hpp",
+        15,
+        Some("WattPerSquareMeterSteradianMeter"),
+    ),
+    (
+        "PhotonRadiance",
+        "photon_radiance.hpp",
+        16,
+        Some("PhotonPerSquareMeterSecondSteradian"),
+    ),
+    (
+        "SpectralPhotonRadiance",
+        "spectral_photon_radiance.hpp",
+        17,
+        Some("PhotonPerSquareMeterSecondSteradianMeter"),
+    ),
+    ("InverseSolidAngle", "inverse_solid_angle.hpp", 18, None),
+    ("LuminousIntensity", "luminous_intensity.hpp", 19, Some("Candela")),
+    ("LuminousFlux", "luminous_flux.hpp", 20, Some("Lumen")),
+    ("Illuminance", "illuminance.hpp", 21, Some("Lux")),
+    ("Frequency", "frequency.hpp", 22, Some("Hertz")),
+    ("AmountOfSubstance", "amount.hpp", 23, Some("Mole")),
+    ("Current", "current.hpp", 24, Some("Ampere")),
+    ("Charge", "charge.hpp", 25, Some("Coulomb")),
+    ("Voltage", "voltage.hpp", 26, Some("Volt")),
+    ("Resistance", "resistance.hpp", 27, Some("Ohm")),
+    ("Capacitance", "capacitance.hpp", 28, Some("Farad")),
+    ("Inductance", "inductance.hpp", 29, Some("Henry")),
+    ("MagneticFlux", "magnetic_flux.hpp", 30, Some("Weber")),
+    (
+        "MagneticFluxDensity",
+        "magnetic_flux_density.hpp",
+        31,
+        Some("Tesla"),
+    ),
+    ("Density", "density.hpp", 32, Some("KilogramPerCubicMeter")),
+    ("Dimensionless", "dimensionless.hpp", 33, Some("OpticalDepth")),
+];
+
+/// Dimension name → exponents of its coherent SI unit over the base dimensions
+/// of `qtty/exponents.hpp`, in order: length, mass, time, current,
+/// temperature, amount, luminous intensity, plane angle, solid angle.
+const DIMENSION_EXPONENTS: &[(&str, [i8; 9])] = &[
+    ("Length", [1, 0, 0, 0, 0, 0, 0, 0, 0]),
+    ("Time", [0, 0, 1, 0, 0, 0, 0, 0, 0]),
+    ("Angle", [0, 0, 0, 0, 0, 0, 0, 1, 0]),
+    ("Mass", [0, 1, 0, 0, 0, 0, 0, 0, 0]),
+    ("Power", [2, 1, -3, 0, 0, 0, 0, 0, 0]),
+    ("Area", [2, 0, 0, 0, 0, 0, 0, 0, 0]),
+    ("Volume", [3, 0, 0, 0, 0, 0, 0, 0, 0]),
+    ("Acceleration", [1, 0, -2, 0, 0, 0, 0, 0, 0]),
+    ("Force", [1, 1, -2, 0, 0, 0, 0, 0, 0]),
+    ("Energy", [2, 1, -2, 0, 0, 0, 0, 0, 0]),
+    ("Pressure", [-1, 1, -2, 0, 0, 0, 0, 0, 0]),
+    ("SolidAngle", [0, 0, 0, 0, 0, 0, 0, 0, 1]),
+    ("Temperature", [0, 0, 0, 0, 1, 0, 0, 0, 0]),
+    ("Radiance", [0, 1, -3, 0, 0, 0, 0, 0, -1]),
+    ("SpectralRadiance", [-1, 1, -3, 0, 0, 0, 0, 0, -1]),
+    ("PhotonRadiance", [-2, 0, -1, 0, 0, 0, 0, 0, -1]),
+    ("SpectralPhotonRadiance", [-3, 0, -1, 0, 0, 0, 0, 0, -1]),
+    ("InverseSolidAngle", [0, 0, 0, 0, 0, 0, 0, 0, -1]),
+    ("LuminousIntensity", [0, 0, 0, 0, 0, 0, 1, 0, 0]),
+    ("LuminousFlux", [0, 0, 0, 0, 0, 0, 1, 0, 1]),
+    ("Illuminance", [-2, 0, 0, 0, 0, 0, 1, 0, 1]),
+    ("Frequency", [0, 0, -1, 0, 0, 0, 0, 0, 0]),
+    ("AmountOfSubstance", [0, 0, 0, 0, 0, 1, 0, 0, 0]),
+    ("Current", [0, 0, 0, 1, 0, 0, 0, 0, 0]),
+    ("Charge", [0, 0, 1, 1, 0, 0, 0, 0, 0]),
+    ("Voltage", [2, 1, -3, -1, 0, 0, 0, 0, 0]),
+    ("Resistance", [2, 1, -3, -2, 0, 0, 0, 0, 0]),
+    ("Capacitance", [-2, -1, 4, 2, 0, 0, 0, 0, 0]),
+    ("Inductance", [2, 1, -2, -2, 0, 0, 0, 0, 0]),
+    ("MagneticFlux", [2, 1, -2, -1, 0, 0, 0, 0, 0]),
+    ("MagneticFluxDensity", [0, 1, -2, -1, 0, 0, 0, 0, 0]),
+    ("Density", [-3, 1, 0, 0, 0, 0, 0, 0, 0]),
+    ("Dimensionless", [0, 0, 0, 0, 0, 0, 0, 0, 0]),
 ];
 
+/// Dimensions whose exactly defined units also get a rational `si_ratio`.
+const EXACT_RATIO_DIMENSIONS: &[&str] = &["Length", "Time", "Area", "Volume"];
+
+/// Longest decimal significand accepted as an exact definition. Factors that
+/// need more digits to round-trip (e.g. the parsec, derived from π) are
+/// products of irrational or rounded terms and keep only `to_si_factor()`.
+const MAX_EXACT_DIGITS: usize = 15;
+
 // ---------------------------------------------------------------------------
 // Data types
 // ---------------------------------------------------------------------------
@@ -85,6 +167,30 @@ struct UnitDef {
     symbol: String,
     /// Dimension name, e.g. `"Length"`.
     dimension: String,
+    /// Raw discriminant, e.g. `10015`.
+    discriminant: u32,
+    /// Value of one unit in the SI reference unit of its dimension, resolved
+    /// through the FFI after parsing (`None` when it cannot be resolved).
+    to_si_factor: Option<f64>,
+    /// `to_si_factor` as a reduced fraction `(num, den)` when the definition is
+    /// an exact decimal (see `exact_si_ratio`).
+    si_ratio: Option<(i64, i64)>,
+}
+
+/// Mirror of the C `qtty_quantity_t` used to query conversion factors.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+struct FfiQuantity {
+    value: f64,
+    unit: u32,
+}
+
+// The generator links the `qtty-ffi` crate, so its exported C entry points are
+// available here. Going through the C ABI keeps the emitted factors identical
+// to what `qtty_quantity_convert` computes at runtime.
+extern "C" {
+    fn qtty_quantity_make(value: f64, unit: u32, out: *mut FfiQuantity) -> i32;
+    fn qtty_quantity_convert(src: FfiQuantity, dst_unit: u32, out: *mut FfiQuantity) -> i32;
 }
 
 // ---------------------------------------------------------------------------
@@ -101,7 +207,8 @@ fn main() {
     let csv_path = Path::new(&args[1]);
     let out_dir = PathBuf::from(&args[2]);
 
-    let units = parse_csv(csv_path);
+    let mut units = parse_csv(csv_path);
+    resolve_si_factors(&mut units);
 
     // Group by dimension, preserving CSV order within each group.
     let mut order: Vec<&str> = Vec::new();
@@ -118,7 +225,7 @@ fn main() {
     let units_dir = out_dir.join("units");
     fs::create_dir_all(&units_dir).expect("Failed to create units output directory");
 
-    for (dim_name, file_name, _) in DIMENSIONS {
+    for (dim_name, file_name, _, _) in DIMENSIONS {
         if let Some(units) = by_dim.get(dim_name) {
             let content = generate_dimension_header(dim_name, units);
             let path = units_dir.join(file_name);
@@ -129,6 +236,12 @@ fn main() {
         }
     }
 
+    // Generate dimensions.hpp (one tag per entry of DIMENSIONS).
+    let dimensions_path = out_dir.join("dimensions.hpp");
+    fs::write(&dimensions_path, generate_dimensions_header())
+        .expect("Failed to write dimensions.hpp");
+    eprintln!("Generated dimensions.hpp");
+
     // Generate literals.hpp.
     let literals_content = generate_literals(&by_dim, &order);
     let literals_path = out_dir.join("literals.hpp");
@@ -243,12 +356,116 @@ fn parse_csv(path: &Path) -> Vec<UnitDef> {
             const_suffix,
             symbol,
             dimension: dimension.to_owned(),
+            discriminant,
+            to_si_factor: None,
+            si_ratio: None,
         });
     }
 
     units
 }
 
+// ---------------------------------------------------------------------------
+// Conversion factors
+// ---------------------------------------------------------------------------
+
+/// Fill in `to_si_factor` for every unit whose dimension has its SI reference
+/// unit present in the CSV.
+///
+/// The factor is obtained by converting `1.0` of the unit into the reference
+/// unit through `qtty_quantity_convert`, so the C++ fast path multiplies by
+/// exactly the same scale the Rust side would apply.
+fn resolve_si_factors(units: &mut [UnitDef]) {
+    let mut references: HashMap<String, u32> = HashMap::new();
+    for (dim_name, _, _, reference) in DIMENSIONS {
+        let Some(reference) = reference else {
+            continue;
+        };
+        if let Some(unit) = units.iter().find(|u| u.name == *reference) {
+            references.insert((*dim_name).to_owned(), unit.discriminant);
+        } else {
+            eprintln!("Warning: SI reference unit {reference} for {dim_name} not found");
+        }
+    }
+
+    for unit in units.iter_mut() {
+        let Some(&reference) = references.get(&unit.dimension) else {
+            continue;
+        };
+        unit.to_si_factor = ffi_convert(1.0, unit.discriminant, reference);
+        if unit.to_si_factor.is_none() {
+            eprintln!(
+                "Warning: could not resolve SI factor for {} ({})",
+                unit.name, unit.discriminant
+            );
+        }
+        if EXACT_RATIO_DIMENSIONS.contains(&unit.dimension.as_str()) {
+            unit.si_ratio = unit.to_si_factor.and_then(exact_si_ratio);
+        }
+    }
+}
+
+/// Recover the exact rational behind an SI factor.
+///
+/// Exact unit definitions are short decimals (`0.0254`, `1609.344`,
+/// `86400 * 36525`), so the shortest round-trip rendering of the factor is
+/// that decimal. It is accepted when it has at most `MAX_EXACT_DIGITS`
+/// significant digits and the reduced fraction fits in a C++ `intmax_t`.
+fn exact_si_ratio(factor: f64) -> Option<(i64, i64)> {
+    if !(factor.is_finite() && factor > 0.0) {
+        return None;
+    }
+    let rendered = format!("{factor:e}");
+    let (mantissa, exponent) = rendered.split_once('e')?;
+    let exponent: i32 = exponent.parse().ok()?;
+    let (int_part, frac_part) = mantissa.split_once('.').unwrap_or((mantissa, ""));
+    let digits = format!("{int_part}{frac_part}");
+    if digits.len() > MAX_EXACT_DIGITS {
+        return None;
+    }
+
+    let significand: i128 = digits.parse().ok()?;
+    let exponent = exponent - frac_part.len() as i32;
+    let scale = 10_i128.checked_pow(exponent.unsigned_abs())?;
+    let (num, den) = if exponent >= 0 {
+        (significand.checked_mul(scale)?, 1)
+    } else {
+        (significand, scale)
+    };
+
+    let divisor = gcd(num, den);
+    let num = i64::try_from(num / divisor).ok()?;
+    let den = i64::try_from(den / divisor).ok()?;
+    Some((num, den))
+}
+
+fn gcd(mut a: i128, mut b: i128) -> i128 {
+    while b != 0 {
+        (a, b) = (b, a % b);
+    }
+    a
+}
+
+/// Convert `value` from `src` to `dst` through the qtty-ffi C ABI.
+fn ffi_convert(value: f64, src: u32, dst: u32) -> Option<f64> {
+    let mut made = FfiQuantity {
+        value: 0.0,
+        unit: 0,
+    };
+    let mut out = FfiQuantity {
+        value: 0.0,
+        unit: 0,
+    };
+    // SAFETY: both discriminants come from `discriminants.csv` and were
+    // validated through `UnitId::from_u32`; the out pointers are valid locals.
+    let status = unsafe { qtty_quantity_make(value, src, &mut made) };
+    if status != 0 {
+        return None;
+    }
+    let status = unsafe { qtty_quantity_convert(made, dst, &mut out) };
+    (status == 0 && out.value.is_finite()).then_some(out.value)
+}
+
 // ---------------------------------------------------------------------------
 // Name conversion
 // ---------------------------------------------------------------------------
@@ -293,13 +510,14 @@ fn pascal_to_upper_snake(name: &str) -> String {
 // Header generation — dimension files
 // ---------------------------------------------------------------------------
 
-fn generate_dimension_header(_dimension: &str, units: &[&UnitDef]) -> String {
+fn generate_dimension_header(dimension: &str, units: &[&UnitDef]) -> String {
     let mut s = String::new();
 
     // License + pragma once + include
     writeln!(s, "{LICENSE}").unwrap();
     writeln!(s, "#pragma once").unwrap();
     writeln!(s).unwrap();
+    writeln!(s, "#include \"../dimensions.hpp\"").unwrap();
     writeln!(s, "#include \"../ffi_core.hpp\"").unwrap();
     writeln!(s).unwrap();
     writeln!(s, "namespace qtty {{").unwrap();
@@ -314,6 +532,7 @@ fn generate_dimension_header(_dimension: &str, units: &[&UnitDef]) -> String {
     // UnitTraits specializations
     for unit in units {
         writeln!(s, "template <> struct UnitTraits<{}Tag> {{", unit.name).unwrap();
+        writeln!(s, "  using dimension = dim::{dimension};").unwrap();
         write_wrapped_member_return(
             &mut s,
             "UnitId",
@@ -326,6 +545,17 @@ fn generate_dimension_header(_dimension: &str, units: &[&UnitDef]) -> String {
             escape_cpp_string(&unit.symbol)
         )
         .unwrap();
+        if let Some(factor) = unit.to_si_factor {
+            write_wrapped_member_return(
+                &mut s,
+                "double",
+                "to_si_factor()",
+                &format_cpp_double(factor),
+            );
+        }
+        if let Some((num, den)) = unit.si_ratio {
+            writeln!(s, "  using si_ratio = std::ratio<{num}, {den}>;").unwrap();
+        }
         writeln!(s, "}};").unwrap();
     }
     writeln!(s).unwrap();
@@ -341,6 +571,48 @@ fn generate_dimension_header(_dimension: &str, units: &[&UnitDef]) -> String {
     s
 }
 
+// ---------------------------------------------------------------------------
+// Header generation — dimensions.hpp
+// ---------------------------------------------------------------------------
+
+/// One tag struct per dimension, referenced by `UnitTraits::dimension` and
+/// carrying the SI exponents of the dimension.
+fn generate_dimensions_header() -> String {
+    let mut s = String::new();
+
+    writeln!(s, "{LICENSE}").unwrap();
+    writeln!(s, "#pragma once").unwrap();
+    writeln!(s).unwrap();
+    writeln!(s, "#include \"exponents.hpp\"").unwrap();
+    writeln!(s).unwrap();
+    writeln!(s, "namespace qtty {{").unwrap();
+    writeln!(s, "namespace dim {{").unwrap();
+    writeln!(s).unwrap();
+    for (dim_name, _, _, _) in DIMENSIONS {
+        let exponents = dimension_exponents(dim_name)
+            .iter()
+            .map(|e| e.to_string())
+            .collect::<Vec<_>>()
+            .join(", ");
+        writeln!(s, "struct {dim_name} {{").unwrap();
+        writeln!(s, "  static constexpr Exponents exponents{{{{{exponents}}}}};").unwrap();
+        writeln!(s, "}};").unwrap();
+    }
+    writeln!(s).unwrap();
+    writeln!(s, "}} // namespace dim").unwrap();
+    writeln!(s, "}} // namespace qtty").unwrap();
+
+    s
+}
+
+fn dimension_exponents(dimension: &str) -> &'static [i8; 9] {
+    DIMENSION_EXPONENTS
+        .iter()
+        .find(|(name, _)| *name == dimension)
+        .map(|(_, exponents)| exponents)
+        .unwrap_or_else(|| panic!("No SI exponents for dimension {dimension}"))
+}
+
 // ---------------------------------------------------------------------------
 // Header generation — literals.hpp
 // ---------------------------------------------------------------------------
@@ -399,7 +671,7 @@ fn generate_literals(by_dim: &HashMap<&str, Vec<&UnitDef>>, _order: &[&str]) ->
 
     let mut used_suffixes: HashMap<String, String> = HashMap::new();
 
-    for (dim_name, _, _) in DIMENSIONS {
+    for (dim_name, _, _, _) in DIMENSIONS {
         let Some(units) = by_dim.get(dim_name) else {
             continue;
         };
@@ -491,6 +763,14 @@ fn make_literal_suffix(symbol: &str) -> Option<String> {
     }
 }
 
+/// Format an `f64` as a C++ floating-point literal that round-trips exactly.
+//
+/// Uses Rust's shortest round-trip `LowerExp` rendering (`1e3`, `2.54e-2`),
+/// which is also a valid C++ `double` literal.
+fn format_cpp_double(value: f64) -> String {
+    format!("{value:e}")
+}
+
 /// Escape a string for embedding in a C++ string literal.
 //
 /// Currently only escapes backslashes and double-quotes; all other characters
@@ -598,6 +878,47 @@ mod tests {
         assert_eq!(make_literal_suffix("′").as_deref(), Some("arcmin"));
     }
 
+    #[test]
+    fn cpp_double_round_trips() {
+        assert_eq!(format_cpp_double(1.0), "1e0");
+        assert_eq!(format_cpp_double(1000.0), "1e3");
+        assert_eq!(format_cpp_double(0.0254), "2.54e-2");
+        assert_eq!(format_cpp_double(149597870700.0), "1.495978707e11");
+        let pc = 3.0856775814913673e16;
+        assert_eq!(format_cpp_double(pc).parse::<f64>().unwrap(), pc);
+    }
+
+    #[test]
+    fn exact_ratio_from_decimal_definitions() {
+        assert_eq!(exact_si_ratio(1.0), Some((1, 1)));
+        assert_eq!(exact_si_ratio(0.0254), Some((127, 5000)));
+        assert_eq!(exact_si_ratio(1609.344), Some((201168, 125)));
+        assert_eq!(exact_si_ratio(3.15576e9), Some((3155760000, 1)));
+        assert_eq!(exact_si_ratio(1e-18), Some((1, 1_000_000_000_000_000_000)));
+        // Denominator beyond intmax_t
+        assert_eq!(exact_si_ratio(1e-21), None);
+        // Derived from π: needs 17 digits to round-trip
+        assert_eq!(exact_si_ratio(3.0856775814913673e16), None);
+        assert_eq!(exact_si_ratio(f64::NAN), None);
+    }
+
+    #[test]
+    fn dimensions_header_lists_every_dimension() {
+        let header = generate_dimensions_header();
+        for (dim_name, _, _, _) in DIMENSIONS {
+            assert!(header.contains(&format!("struct {dim_name} {{")));
+        }
+        assert!(header.contains("struct Energy {\n  static constexpr Exponents exponents{{2, 1, -2,"));
+    }
+
+    #[test]
+    fn every_dimension_has_exponents() {
+        assert_eq!(DIMENSION_EXPONENTS.len(), DIMENSIONS.len());
+        for (dim_name, _, _, _) in DIMENSIONS {
+            dimension_exponents(dim_name);
+        }
+    }
+
     #[test]
     fn literal_suffix_strips_non_ascii() {
         // λ̄_e → after removing non-ASCII chars the underscore and 'e' survive
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file aligned_allocator.hpp
+ * @brief Standard allocator returning over-aligned storage.
+ *
+ * Backs QuantityArray so that every buffer starts on a cache-line (and
+ * AVX-512 register) boundary:
+ *
+ * @code
+ * std::vector<double, qtty::AlignedAllocator<double>> values(1024);
+ * assert(reinterpret_cast<std::uintptr_t>(values.data()) % 64 == 0);
+ * @endcode
+ */
+
+#include <cstddef>
+#include <new>
+
+namespace qtty {
+
+/// Default alignment of qtty containers: one cache line, one AVX-512 register.
+inline constexpr std::size_t kDefaultAlignment = 64;
+
+/**
+ * @brief Allocator whose blocks are aligned to @p Alignment bytes.
+ *
+ * Stateless; all instances compare equal, so containers using it can swap
+ * and move storage freely.
+ */
+template <typename T, std::size_t Alignment = kDefaultAlignment> class AlignedAllocator {
+  static_assert(Alignment >= alignof(T), "Alignment must not be below the alignment of T");
+  static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+public:
+  using value_type = T;
+
+  static constexpr std::size_t alignment = Alignment;
+
+  template <typename U> struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  constexpr AlignedAllocator() noexcept = default;
+  template <typename U>
+  constexpr AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+  T *allocate(std::size_t count) {
+    return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T *ptr, std::size_t) noexcept {
+    ::operator delete(ptr, std::align_val_t(Alignment));
+  }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+constexpr bool operator==(const AlignedAllocator<T, Alignment> &,
+                          const AlignedAllocator<U, Alignment> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U, std::size_t Alignment>
+constexpr bool operator!=(const AlignedAllocator<T, Alignment> &,
+                          const AlignedAllocator<U, Alignment> &) noexcept {
+  return false;
+}
+
+} // namespace qtty
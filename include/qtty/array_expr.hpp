@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file array_expr.hpp
+ * @brief Fused elementwise arithmetic over QuantityArray and QuantitySpan.
+ *
+ * `+`, `-`, `*` and `/` between arrays, spans, single quantities and plain
+ * numbers build a lightweight expression instead of a temporary array. The
+ * whole expression is evaluated in one loop when it is assigned:
+ *
+ * @code
+ * QuantityArray<KilometerTag> pos_km = load_positions();
+ * QuantityArray<CompoundTag<KilometerTag, SecondTag>> vel_kms = load_velocities();
+ * pos_km += vel_kms * Second(60.0);                    // (km/s) * s -> km, one pass
+ * QuantityArray<KilometerTag> next = pos_km + vel_kms * dt_s;   // one pass, no temporaries
+ * @endcode
+ *
+ * Each element is computed with the scalar Quantity operators, so results
+ * follow the same rules: products and quotients produce `ProductTag` /
+ * `CompoundTag` units and cancel as they do for single quantities (length /
+ * time is a velocity), sums of different units of one dimension are taken in
+ * `common_unit_t` through a compile-time factor, and mixing dimensions is a
+ * compile error.
+ */
+
+#include "ffi_core.hpp"
+#include "quantity_span.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace qtty {
+
+template <typename UnitTag, typename Rep, typename Allocator> class QuantityArray;
+template <typename Op, typename Lhs, typename Rhs> class ArrayExpr;
+
+namespace detail {
+
+// Leaf reading a buffer of raw values owned elsewhere
+template <typename UnitTag, typename Rep> class ArrayRef {
+public:
+  static constexpr bool is_broadcast = false;
+
+  constexpr ArrayRef(const Rep *values, std::size_t count) noexcept
+      : m_values(values), m_size(count) {}
+
+  constexpr std::size_t size() const noexcept { return m_size; }
+  constexpr Quantity<UnitTag, Rep> operator[](std::size_t i) const noexcept {
+    return Quantity<UnitTag, Rep>(m_values[i]);
+  }
+
+private:
+  const Rep *m_values;
+  std::size_t m_size;
+};
+
+// Leaf owning an rvalue array, so `make_array() + b` does not dangle
+template <typename Array> class ArrayOwner {
+public:
+  static constexpr bool is_broadcast = false;
+
+  explicit ArrayOwner(Array &&array) noexcept : m_array(std::move(array)) {}
+
+  std::size_t size() const noexcept { return m_array.size(); }
+  auto operator[](std::size_t i) const noexcept { return m_array[i]; }
+
+private:
+  Array m_array;
+};
+
+// Leaf repeating one quantity or number for every element
+template <typename T> class Broadcast {
+public:
+  static constexpr bool is_broadcast = true;
+
+  constexpr explicit Broadcast(T value) noexcept : m_value(value) {}
+
+  constexpr std::size_t size() const noexcept { return 0; }
+  constexpr T operator[](std::size_t) const noexcept { return m_value; }
+
+private:
+  T m_value;
+};
+
+template <typename T> struct is_array_expr : std::false_type {};
+template <typename Op, typename Lhs, typename Rhs>
+struct is_array_expr<ArrayExpr<Op, Lhs, Rhs>> : std::true_type {};
+
+// Operands that make `+ - * /` build an expression
+template <typename T> struct is_array_operand : is_array_expr<T> {};
+template <typename UnitTag, typename Rep, typename Allocator>
+struct is_array_operand<QuantityArray<UnitTag, Rep, Allocator>> : std::true_type {};
+template <typename UnitTag, typename Rep>
+struct is_array_operand<QuantitySpan<UnitTag, Rep>> : std::true_type {};
+
+// Expression nodes for each kind of operand
+template <typename UnitTag, typename Rep, typename Allocator>
+ArrayRef<UnitTag, Rep> capture(const QuantityArray<UnitTag, Rep, Allocator> &array) noexcept {
+  return {array.data(), array.size()};
+}
+
+template <typename UnitTag, typename Rep, typename Allocator>
+ArrayOwner<QuantityArray<UnitTag, Rep, Allocator>>
+capture(QuantityArray<UnitTag, Rep, Allocator> &&array) noexcept {
+  return ArrayOwner<QuantityArray<UnitTag, Rep, Allocator>>(std::move(array));
+}
+
+template <typename UnitTag, typename Rep>
+ArrayRef<UnitTag, std::remove_const_t<Rep>> capture(QuantitySpan<UnitTag, Rep> span) noexcept {
+  return {span.raw_data(), span.size()};
+}
+
+template <typename Op, typename Lhs, typename Rhs>
+ArrayExpr<Op, Lhs, Rhs> capture(ArrayExpr<Op, Lhs, Rhs> expr) noexcept {
+  return expr;
+}
+
+template <typename UnitTag, typename Rep>
+constexpr Broadcast<Quantity<UnitTag, Rep>> capture(const Quantity<UnitTag, Rep> &q) noexcept {
+  return Broadcast<Quantity<UnitTag, Rep>>(q);
+}
+
+template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+constexpr Broadcast<T> capture(T value) noexcept {
+  return Broadcast<T>(value);
+}
+
+template <typename T> using capture_t = decltype(capture(std::declval<T>()));
+
+// Enables the expression operators: one side is an array operand and the
+// other an array operand, a quantity or a number
+template <typename Lhs, typename Rhs>
+using enable_array_expr_t =
+    std::enable_if_t<(is_array_operand<std::decay_t<Lhs>>::value ||
+                      is_array_operand<std::decay_t<Rhs>>::value),
+                     std::void_t<capture_t<Lhs>, capture_t<Rhs>>>;
+
+} // namespace detail
+
+/**
+ * @brief Lazy elementwise `Op` of two expression nodes.
+ *
+ * Produced by the operators below, never named directly. Element `i` is
+ * `Op{}(lhs[i], rhs[i])` with the scalar Quantity operators, so `value_type`
+ * is whatever they return for one element. Array operands are referenced
+ * (rvalue QuantityArrays are moved in); they must match in size, which is
+ * checked when the node is built. Evaluate with a QuantityArray constructor
+ * or assignment, `+=` / `-=`, or evaluate().
+ */
+template <typename Op, typename Lhs, typename Rhs> class ArrayExpr {
+  using lhs_element = decltype(std::declval<const Lhs &>()[0]);
+  using rhs_element = decltype(std::declval<const Rhs &>()[0]);
+  static_assert(std::is_invocable_v<Op, lhs_element, rhs_element>,
+                "Operands have incompatible units: adding different dimensions, or units "
+                "without a compile-time conversion factor");
+
+public:
+  using value_type = std::decay_t<std::invoke_result_t<Op, lhs_element, rhs_element>>;
+  using size_type = std::size_t;
+
+  static constexpr bool is_broadcast = false;
+
+  /// @throws QttyException when two array operands differ in size.
+  ArrayExpr(Lhs lhs, Rhs rhs) : m_lhs(std::move(lhs)), m_rhs(std::move(rhs)) {
+    if constexpr (!Lhs::is_broadcast && !Rhs::is_broadcast) {
+      detail::check_same_size(m_lhs.size(), m_rhs.size(), "ArrayExpr");
+    }
+  }
+
+  size_type size() const noexcept { return Lhs::is_broadcast ? m_rhs.size() : m_lhs.size(); }
+
+  value_type operator[](size_type i) const noexcept { return Op{}(m_lhs[i], m_rhs[i]); }
+
+private:
+  Lhs m_lhs;
+  Rhs m_rhs;
+};
+
+// ============================================================================
+// Expression Operators
+// ============================================================================
+
+template <typename Lhs, typename Rhs, typename = detail::enable_array_expr_t<Lhs, Rhs>>
+ArrayExpr<std::plus<>, detail::capture_t<Lhs>, detail::capture_t<Rhs>>
+operator+(Lhs &&lhs, Rhs &&rhs) {
+  return {detail::capture(std::forward<Lhs>(lhs)), detail::capture(std::forward<Rhs>(rhs))};
+}
+
+template <typename Lhs, typename Rhs, typename = detail::enable_array_expr_t<Lhs, Rhs>>
+ArrayExpr<std::minus<>, detail::capture_t<Lhs>, detail::capture_t<Rhs>>
+operator-(Lhs &&lhs, Rhs &&rhs) {
+  return {detail::capture(std::forward<Lhs>(lhs)), detail::capture(std::forward<Rhs>(rhs))};
+}
+
+template <typename Lhs, typename Rhs, typename = detail::enable_array_expr_t<Lhs, Rhs>>
+ArrayExpr<std::multiplies<>, detail::capture_t<Lhs>, detail::capture_t<Rhs>>
+operator*(Lhs &&lhs, Rhs &&rhs) {
+  return {detail::capture(std::forward<Lhs>(lhs)), detail::capture(std::forward<Rhs>(rhs))};
+}
+
+template <typename Lhs, typename Rhs, typename = detail::enable_array_expr_t<Lhs, Rhs>>
+ArrayExpr<std::divides<>, detail::capture_t<Lhs>, detail::capture_t<Rhs>>
+operator/(Lhs &&lhs, Rhs &&rhs) {
+  return {detail::capture(std::forward<Lhs>(lhs)), detail::capture(std::forward<Rhs>(rhs))};
+}
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+namespace detail {
+
+// out[i] = Combine(out[i], expr[i] expressed in UnitTag) for i in [first,
+// last), in one loop
+template <typename UnitTag, typename Rep, typename Expr, typename Combine>
+void evaluate_range(Rep *out, const Expr &expr, Combine combine, std::size_t first,
+                    std::size_t last) noexcept {
+  static_assert(!std::is_arithmetic_v<typename Expr::value_type>,
+                "Dimensionless expressions have no unit to store");
+  using ExprTag = typename Expr::value_type::unit_tag;
+  static_assert(reexpressible<ExprTag, UnitTag>(),
+                "Expression unit must convert to the destination unit at compile time");
+  for (std::size_t i = first; i < last; ++i) {
+    out[i] = to_rep<Rep>(combine(out[i], value_in<UnitTag>(expr[i])));
+  }
+}
+
+template <typename UnitTag, typename Rep, typename Expr, typename Combine>
+void evaluate_into(Rep *out, const Expr &expr, Combine combine) noexcept {
+  evaluate_range<UnitTag>(out, expr, combine, 0, expr.size());
+}
+
+struct AssignValue {
+  template <typename Rep, typename T> constexpr T operator()(Rep, T value) const noexcept {
+    return value;
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief Evaluate @p expr into @p out, converting to the unit of @p out.
+ * @throws QttyException when the sizes differ.
+ */
+template <typename Op, typename Lhs, typename Rhs, typename UnitTag, typename Rep,
+          typename = std::enable_if_t<!std::is_const_v<Rep>>>
+void evaluate(const ArrayExpr<Op, Lhs, Rhs> &expr, QuantitySpan<UnitTag, Rep> out) {
+  detail::check_same_size(expr.size(), out.size(), "evaluate");
+  detail::evaluate_into<UnitTag>(out.raw_data(), expr, detail::AssignValue{});
+}
+
+} // namespace qtty
@@ -0,0 +1,627 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file binary.hpp
+ * @brief Compact, versioned little-endian binary encoding of quantities.
+ *
+ * A record is a small header naming the unit followed by the raw IEEE-754
+ * payload, so encoding a `double` or `float` column is a header write and one
+ * `memcpy`, and decoding can hand out a QuantitySpan over the received bytes:
+ *
+ * @code
+ * std::vector<std::byte> wire(qtty::binary::encoded_size(distances.span()));
+ * qtty::binary::encode_into(distances.span(), wire.data(), wire.size());
+ * auto view = qtty::binary::decode_view<qtty::Meter>(wire.data(), wire.size());
+ * auto km = qtty::binary::decode_array<qtty::Kilometer>(wire.data(), wire.size());
+ * @endcode
+ *
+ * Record layout (all integers little-endian):
+ *
+ * | Offset | Size | Field |
+ * |--------|------|-------|
+ * | 0      | 2    | Magic `QB` |
+ * | 2      | 1    | Format version (kFormatVersion) |
+ * | 3      | 1    | Flags: bit 0 f32 payload (else f64), bit 1 array |
+ * | 4      | 4    | Unit id (numerator of a CompoundTag) |
+ * | 8      | 4    | Denominator unit id of a CompoundTag, else kNoUnit |
+ * | 12     | 4    | Arrays only: reserved, zero |
+ * | 16     | 8    | Arrays only: element count |
+ *
+ * The payload follows at kValueHeaderSize (12) for a single value and at
+ * kArrayHeaderSize (24) for an array, so an array payload is 8-byte aligned
+ * whenever the record is. Big-endian hosts byte-swap the payload in one
+ * vectorizable pass.
+ */
+
+#include "ffi_core.hpp"
+#include "quantity_array.hpp"
+#include "quantity_span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+namespace qtty {
+
+namespace binary {
+
+/// Version written into every record; newer versions are rejected on read.
+inline constexpr std::uint8_t kFormatVersion = 1;
+/// Header bytes before the payload of a single value.
+inline constexpr std::size_t kValueHeaderSize = 12;
+/// Header bytes before the payload of an array.
+inline constexpr std::size_t kArrayHeaderSize = 24;
+/// Denominator unit id of quantities that are not a CompoundTag.
+inline constexpr UnitId kNoUnit = 0;
+
+/**
+ * @brief Decoded record header.
+ */
+struct Header {
+  std::uint8_t version = 0;
+  bool array = false;             ///< Array record (else a single value)
+  std::size_t scalar_size = 0;    ///< 8 for an f64 payload, 4 for f32
+  UnitId unit{};                  ///< Unit, or numerator of a compound unit
+  UnitId denominator{};           ///< Denominator of a compound unit, or kNoUnit
+  std::uint64_t count = 0;        ///< Number of values (1 for a single value)
+  std::size_t payload_offset = 0; ///< Offset of the payload from the record start
+
+  /// Total record size in bytes.
+  std::size_t size() const noexcept {
+    return payload_offset + static_cast<std::size_t>(count) * scalar_size;
+  }
+};
+
+} // namespace binary
+
+namespace detail {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr bool kBigEndianHost = true;
+#else
+inline constexpr bool kBigEndianHost = false;
+#endif
+
+inline constexpr std::uint8_t kBinaryFlagF32 = 0x1;
+inline constexpr std::uint8_t kBinaryFlagArray = 0x2;
+
+// Unsigned word with the size of a payload scalar
+template <typename Rep>
+using wire_word_t = std::conditional_t<sizeof(Rep) == 8, std::uint64_t, std::uint32_t>;
+
+template <typename Word> constexpr Word byteswap(Word word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  if constexpr (sizeof(Word) == 8) {
+    return __builtin_bswap64(word);
+  } else {
+    return __builtin_bswap32(word);
+  }
+#else
+  Word swapped = 0;
+  for (std::size_t i = 0; i < sizeof(Word); ++i) {
+    swapped = static_cast<Word>((swapped << 8) | (word & 0xff));
+    word = static_cast<Word>(word >> 8);
+  }
+  return swapped;
+#endif
+}
+
+// Copy @p count words from @p src to @p dst reversing the bytes of each; a
+// shuffle per vector once compiled with SSSE3/AVX2 (or NEON)
+template <typename Word>
+void byteswap_copy(void *dst, const void *src, std::size_t count) noexcept {
+  auto *out = static_cast<unsigned char *>(dst);
+  const auto *in = static_cast<const unsigned char *>(src);
+  for (std::size_t i = 0; i < count; ++i) {
+    Word word;
+    std::memcpy(&word, in + i * sizeof(Word), sizeof(Word));
+    word = byteswap(word);
+    std::memcpy(out + i * sizeof(Word), &word, sizeof(Word));
+  }
+}
+
+// Copy @p count scalars between host order and little-endian wire order
+template <typename Rep>
+void copy_little_endian(void *dst, const void *src, std::size_t count) noexcept {
+  if constexpr (kBigEndianHost) {
+    byteswap_copy<wire_word_t<Rep>>(dst, src, count);
+  } else if (count != 0) {
+    std::memcpy(dst, src, count * sizeof(Rep));
+  }
+}
+
+template <typename Word> void store_little_endian(std::byte *out, Word word) noexcept {
+  if constexpr (kBigEndianHost) {
+    word = byteswap(word);
+  }
+  std::memcpy(out, &word, sizeof(Word));
+}
+
+template <typename Word> Word load_little_endian(const std::byte *in) noexcept {
+  Word word;
+  std::memcpy(&word, in, sizeof(Word));
+  if constexpr (kBigEndianHost) {
+    word = byteswap(word);
+  }
+  return word;
+}
+
+template <typename Rep> Rep load_scalar(const std::byte *in) noexcept {
+  const wire_word_t<Rep> word = load_little_endian<wire_word_t<Rep>>(in);
+  Rep value;
+  std::memcpy(&value, &word, sizeof(Rep));
+  return value;
+}
+
+template <typename Rep> constexpr void check_binary_rep() noexcept {
+  static_assert(has_simd_kernels_v<Rep>, "binary payloads hold double or float values");
+}
+
+// Wire unit ids of a tag: (unit, kNoUnit), or (numerator, denominator)
+template <typename UnitTag> constexpr UnitId wire_unit() noexcept {
+  if constexpr (is_compound_v<UnitTag>) {
+    return UnitTraits<UnitTag>::numerator_unit_id();
+  } else {
+    return UnitTraits<UnitTag>::unit_id();
+  }
+}
+
+template <typename UnitTag> constexpr UnitId wire_denominator() noexcept {
+  if constexpr (is_compound_v<UnitTag>) {
+    return UnitTraits<UnitTag>::denominator_unit_id();
+  } else {
+    return binary::kNoUnit;
+  }
+}
+
+template <typename UnitTag, typename Rep>
+void write_binary_header(std::byte *out, bool array, std::uint64_t count) noexcept {
+  out[0] = std::byte{'Q'};
+  out[1] = std::byte{'B'};
+  out[2] = std::byte{binary::kFormatVersion};
+  out[3] = std::byte{static_cast<std::uint8_t>((sizeof(Rep) == 4 ? kBinaryFlagF32 : 0) |
+                                               (array ? kBinaryFlagArray : 0))};
+  store_little_endian(out + 4, static_cast<std::uint32_t>(wire_unit<UnitTag>()));
+  store_little_endian(out + 8, static_cast<std::uint32_t>(wire_denominator<UnitTag>()));
+  if (array) {
+    store_little_endian<std::uint32_t>(out + 12, 0);
+    store_little_endian<std::uint64_t>(out + 16, count);
+  }
+}
+
+// Payload values as `Rep`, widened or rounded when the record holds the other
+// precision
+template <typename Rep>
+void read_payload(const binary::Header &header, const std::byte *payload, Rep *out) noexcept {
+  const auto count = static_cast<std::size_t>(header.count);
+  if (header.scalar_size == sizeof(Rep)) {
+    copy_little_endian<Rep>(out, payload, count);
+  } else if (header.scalar_size == sizeof(double)) {
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<Rep>(load_scalar<double>(payload + i * sizeof(double)));
+    }
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<Rep>(load_scalar<float>(payload + i * sizeof(float)));
+    }
+  }
+}
+
+// Convert @p count values in place from numerator/denominator units to others:
+// one factor when both parts are linear, qtty_derived_convert() otherwise
+template <typename Rep>
+QttyStatus try_convert_compound_batch(UnitId num_from, UnitId den_from, UnitId num_to,
+                                      UnitId den_to, Rep *data, std::size_t count) noexcept {
+  if (count == 0 || (num_from == num_to && den_from == den_to)) {
+    return QTTY_STATUS_OK;
+  }
+  double num_factor = 0.0;
+  double den_factor = 0.0;
+  bool num_linear = false;
+  bool den_linear = false;
+  QttyStatus status = resolve_conversion_factor(num_from, num_to, num_factor, num_linear);
+  if (status == QTTY_STATUS_OK) {
+    status = resolve_conversion_factor(den_from, den_to, den_factor, den_linear);
+  }
+  if (status != QTTY_STATUS_OK) {
+    return status;
+  }
+  if (num_linear && den_linear) {
+    simd::scale(data, data, count, static_cast<Rep>(num_factor / den_factor));
+    return QTTY_STATUS_OK;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    qtty_derived_quantity_t src{};
+    qtty_derived_quantity_t dst{};
+    status = qtty_derived_make(static_cast<double>(data[i]), num_from, den_from, &src);
+    if (status == QTTY_STATUS_OK) {
+      status = qtty_derived_convert(src, num_to, den_to, &dst);
+    }
+    if (status != QTTY_STATUS_OK) {
+      return status;
+    }
+    data[i] = static_cast<Rep>(dst.value);
+  }
+  return QTTY_STATUS_OK;
+}
+
+// Whether values stored in unit/denominator can be read as `UnitTag`
+template <typename UnitTag> QttyStatus check_wire_units(UnitId unit, UnitId denominator) noexcept {
+  if ((denominator != binary::kNoUnit) != is_compound_v<UnitTag>) {
+    return QTTY_STATUS_INCOMPATIBLE_DIM;
+  }
+  double factor = 0.0;
+  bool linear = false;
+  QttyStatus status = resolve_conversion_factor(unit, wire_unit<UnitTag>(), factor, linear);
+  if (status == QTTY_STATUS_OK && is_compound_v<UnitTag>) {
+    status = resolve_conversion_factor(denominator, wire_denominator<UnitTag>(), factor, linear);
+  }
+  return status;
+}
+
+// Convert values in place from the stored unit/denominator to `UnitTag`
+template <typename UnitTag, typename Rep>
+QttyStatus convert_from_wire(UnitId unit, UnitId denominator, Rep *data,
+                             std::size_t count) noexcept {
+  if ((denominator != binary::kNoUnit) != is_compound_v<UnitTag>) {
+    return QTTY_STATUS_INCOMPATIBLE_DIM;
+  }
+  if constexpr (is_compound_v<UnitTag>) {
+    return try_convert_compound_batch(unit, denominator, wire_unit<UnitTag>(),
+                                      wire_denominator<UnitTag>(), data, count);
+  } else {
+    return try_convert_batch_runtime(unit, wire_unit<UnitTag>(), data, data, count);
+  }
+}
+
+} // namespace detail
+
+namespace binary {
+
+// ============================================================================
+// Encoding
+// ============================================================================
+// The payload keeps the representation of the quantity: `double` values are
+// written as f64, `float` values as f32.
+
+/// Encoded size of a single value, in bytes.
+template <typename UnitTag, typename Rep>
+constexpr std::size_t encoded_size(const Quantity<UnitTag, Rep> &) noexcept {
+  return kValueHeaderSize + sizeof(Rep);
+}
+
+/// Encoded size of an array, in bytes.
+template <typename UnitTag, typename Rep>
+constexpr std::size_t encoded_size(QuantitySpan<UnitTag, Rep> values) noexcept {
+  return kArrayHeaderSize + values.size() * sizeof(Rep);
+}
+
+/**
+ * @brief Encode a single value into a caller buffer, without throwing.
+ * @return Bytes written, or `QTTY_STATUS_BUFFER_TOO_SMALL` when @p size is
+ *         below encoded_size().
+ */
+template <typename UnitTag, typename Rep>
+Result<std::size_t> try_encode_into(const Quantity<UnitTag, Rep> &q, std::byte *out,
+                                    std::size_t size) noexcept {
+  detail::check_binary_rep<Rep>();
+  if (size < encoded_size(q)) {
+    return Result<std::size_t>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
+  detail::write_binary_header<UnitTag, Rep>(out, false, 1);
+  const Rep value = q.value();
+  detail::copy_little_endian<Rep>(out + kValueHeaderSize, &value, 1);
+  return encoded_size(q);
+}
+
+/**
+ * @brief Encode an array into a caller buffer, without throwing.
+ *
+ * The payload is a single copy of the span's buffer (a byte-swapping copy on
+ * big-endian hosts).
+ * @return Bytes written, or `QTTY_STATUS_BUFFER_TOO_SMALL` when @p size is
+ *         below encoded_size().
+ */
+template <typename UnitTag, typename Rep>
+Result<std::size_t> try_encode_into(QuantitySpan<UnitTag, Rep> values, std::byte *out,
+                                    std::size_t size) noexcept {
+  using R = std::remove_const_t<Rep>;
+  detail::check_binary_rep<R>();
+  if (size < encoded_size(values)) {
+    return Result<std::size_t>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
+  detail::write_binary_header<UnitTag, R>(out, true, values.size());
+  detail::copy_little_endian<R>(out + kArrayHeaderSize, values.raw_data(), values.size());
+  return encoded_size(values);
+}
+
+/**
+ * @brief Encode a single value into a caller buffer.
+ * @return Bytes written.
+ * @throws QttyException when @p size is below encoded_size().
+ */
+template <typename UnitTag, typename Rep>
+std::size_t encode_into(const Quantity<UnitTag, Rep> &q, std::byte *out, std::size_t size) {
+  const Result<std::size_t> written = try_encode_into(q, out, size);
+  check_status(written.status(), "Encoding quantity");
+  return *written;
+}
+
+/**
+ * @brief Encode an array into a caller buffer.
+ * @return Bytes written.
+ * @throws QttyException when @p size is below encoded_size().
+ */
+template <typename UnitTag, typename Rep>
+std::size_t encode_into(QuantitySpan<UnitTag, Rep> values, std::byte *out, std::size_t size) {
+  const Result<std::size_t> written = try_encode_into(values, out, size);
+  check_status(written.status(), "Encoding quantity array");
+  return *written;
+}
+
+/// Encode a single value into a new buffer.
+template <typename UnitTag, typename Rep>
+std::vector<std::byte> encode(const Quantity<UnitTag, Rep> &q) {
+  std::vector<std::byte> out(encoded_size(q));
+  try_encode_into(q, out.data(), out.size());
+  return out;
+}
+
+/// Encode an array into a new buffer.
+template <typename UnitTag, typename Rep>
+std::vector<std::byte> encode(QuantitySpan<UnitTag, Rep> values) {
+  std::vector<std::byte> out(encoded_size(values));
+  try_encode_into(values, out.data(), out.size());
+  return out;
+}
+
+// ============================================================================
+// Decoding
+// ============================================================================
+// Records may be followed by other data; Header::size() is the number of
+// bytes a record occupies. Truncated input fails with
+// `QTTY_STATUS_BUFFER_TOO_SMALL`, anything that is not a record of a known
+// version with `kStatusMalformedInput`. Values stored in another unit of the
+// same dimension are converted in bulk; other dimensions fail with
+// `QTTY_STATUS_INCOMPATIBLE_DIM`.
+
+/**
+ * @brief Read and validate the header of the record at @p data.
+ */
+inline Result<Header> try_read_header(const std::byte *data, std::size_t size) noexcept {
+  if (size < kValueHeaderSize) {
+    return Result<Header>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
+  const auto flags = static_cast<std::uint8_t>(data[3]);
+  if (data[0] != std::byte{'Q'} || data[1] != std::byte{'B'} || data[2] == std::byte{0} ||
+      static_cast<std::uint8_t>(data[2]) > kFormatVersion ||
+      (flags & ~(detail::kBinaryFlagF32 | detail::kBinaryFlagArray)) != 0) {
+    return Result<Header>::from_status(kStatusMalformedInput);
+  }
+
+  Header header;
+  header.version = static_cast<std::uint8_t>(data[2]);
+  header.array = (flags & detail::kBinaryFlagArray) != 0;
+  header.scalar_size = (flags & detail::kBinaryFlagF32) != 0 ? sizeof(float) : sizeof(double);
+  header.unit = static_cast<UnitId>(detail::load_little_endian<std::uint32_t>(data + 4));
+  header.denominator = static_cast<UnitId>(detail::load_little_endian<std::uint32_t>(data + 8));
+  header.count = 1;
+  header.payload_offset = kValueHeaderSize;
+  if (header.array) {
+    if (size < kArrayHeaderSize) {
+      return Result<Header>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+    }
+    if (detail::load_little_endian<std::uint32_t>(data + 12) != 0) {
+      return Result<Header>::from_status(kStatusMalformedInput);
+    }
+    header.count = detail::load_little_endian<std::uint64_t>(data + 16);
+    header.payload_offset = kArrayHeaderSize;
+  }
+  if (header.count > (size - header.payload_offset) / header.scalar_size) {
+    return Result<Header>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
+  return header;
+}
+
+/**
+ * @brief Decode a single-value record, without throwing.
+ * @tparam T Unit tag or Quantity type to decode into (`double` or `float`).
+ */
+template <typename T>
+Result<quantity_type_t<T>> try_decode(const std::byte *data, std::size_t size) noexcept {
+  using Target = quantity_type_t<T>;
+  using Rep = typename Target::rep;
+  detail::check_binary_rep<Rep>();
+  const Result<Header> header = try_read_header(data, size);
+  if (!header) {
+    return Result<Target>::from_status(header.status());
+  }
+  if (header->array) {
+    return Result<Target>::from_status(kStatusMalformedInput);
+  }
+  Rep value;
+  detail::read_payload(*header, data + header->payload_offset, &value);
+  const QttyStatus status =
+      detail::convert_from_wire<typename Target::unit_tag>(header->unit, header->denominator,
+                                                           &value, 1);
+  if (status != QTTY_STATUS_OK) {
+    return Result<Target>::from_status(status);
+  }
+  return Target(value);
+}
+
+/**
+ * @brief Decode an array record into a new QuantityArray, without throwing.
+ *
+ * The payload is copied once and then converted in place when its unit or
+ * precision differs from `T`.
+ * @tparam T Unit tag or Quantity type of the elements (`double` or `float`).
+ */
+template <typename T>
+Result<quantity_array_t<T>> try_decode_array(const std::byte *data, std::size_t size) {
+  using Array = quantity_array_t<T>;
+  detail::check_binary_rep<typename Array::rep>();
+  const Result<Header> header = try_read_header(data, size);
+  if (!header) {
+    return Result<Array>::from_status(header.status());
+  }
+  if (!header->array) {
+    return Result<Array>::from_status(kStatusMalformedInput);
+  }
+  Array out(static_cast<std::size_t>(header->count));
+  detail::read_payload(*header, data + header->payload_offset, out.data());
+  const QttyStatus status =
+      detail::convert_from_wire<typename Array::unit_tag>(header->unit, header->denominator,
+                                                          out.data(), out.size());
+  if (status != QTTY_STATUS_OK) {
+    return Result<Array>::from_status(status);
+  }
+  return out;
+}
+
+/**
+ * @brief View the payload of an array record in place, without throwing.
+ *
+ * Succeeds when the record holds exactly `T`'s unit and representation, the
+ * payload is aligned for it and the host is little-endian. Another unit of
+ * the same dimension fails with `kStatusNotViewable` (decode with
+ * try_decode_array() instead), another dimension with
+ * `QTTY_STATUS_INCOMPATIBLE_DIM`. The view borrows @p data.
+ */
+template <typename T>
+Result<ConstQuantitySpan<typename ExtractTag<T>::type, typename ExtractRep<T>::type>>
+try_decode_view(const std::byte *data, std::size_t size) noexcept {
+  using UnitTag = typename ExtractTag<T>::type;
+  using Rep = typename ExtractRep<T>::type;
+  using View = ConstQuantitySpan<UnitTag, Rep>;
+  detail::check_binary_rep<Rep>();
+  const Result<Header> header = try_read_header(data, size);
+  if (!header) {
+    return Result<View>::from_status(header.status());
+  }
+  if (!header->array) {
+    return Result<View>::from_status(kStatusMalformedInput);
+  }
+  const bool same_units = header->unit == detail::wire_unit<UnitTag>() &&
+                          header->denominator == detail::wire_denominator<UnitTag>();
+  if (!same_units) {
+    const QttyStatus status =
+        detail::check_wire_units<UnitTag>(header->unit, header->denominator);
+    if (status != QTTY_STATUS_OK) {
+      return Result<View>::from_status(status);
+    }
+  }
+  const std::byte *payload = data + header->payload_offset;
+  if (detail::kBigEndianHost || !same_units || header->scalar_size != sizeof(Rep) ||
+      reinterpret_cast<std::uintptr_t>(payload) % alignof(Rep) != 0) {
+    return Result<View>::from_status(kStatusNotViewable);
+  }
+  return View(reinterpret_cast<const Rep *>(payload), static_cast<std::size_t>(header->count));
+}
+
+/**
+ * @brief Decode a single-value record.
+ * @see try_decode()
+ * @throws QttyException and derived exception types on failure.
+ */
+template <typename T> quantity_type_t<T> decode(const std::byte *data, std::size_t size) {
+  const auto result = try_decode<T>(data, size);
+  check_status(result.status(), "Decoding quantity");
+  return *result;
+}
+
+/**
+ * @brief Decode an array record into a new QuantityArray.
+ * @see try_decode_array()
+ * @throws QttyException and derived exception types on failure.
+ */
+template <typename T> quantity_array_t<T> decode_array(const std::byte *data, std::size_t size) {
+  auto result = try_decode_array<T>(data, size);
+  check_status(result.status(), "Decoding quantity array");
+  return std::move(*result);
+}
+
+/**
+ * @brief View the payload of an array record in place.
+ * @see try_decode_view()
+ * @throws QttyException and derived exception types on failure.
+ */
+template <typename T>
+ConstQuantitySpan<typename ExtractTag<T>::type, typename ExtractRep<T>::type>
+decode_view(const std::byte *data, std::size_t size) {
+  const auto result = try_decode_view<T>(data, size);
+  check_status(result.status(), "Viewing quantity array");
+  return *result;
+}
+
+#if __cplusplus >= 202002L
+// std::span overloads of the encoding and decoding entry points (C++20).
+
+template <typename UnitTag, typename Rep>
+Result<std::size_t> try_encode_into(const Quantity<UnitTag, Rep> &q,
+                                    std::span<std::byte> out) noexcept {
+  return try_encode_into(q, out.data(), out.size());
+}
+
+template <typename UnitTag, typename Rep>
+Result<std::size_t> try_encode_into(QuantitySpan<UnitTag, Rep> values,
+                                    std::span<std::byte> out) noexcept {
+  return try_encode_into(values, out.data(), out.size());
+}
+
+template <typename UnitTag, typename Rep>
+std::size_t encode_into(const Quantity<UnitTag, Rep> &q, std::span<std::byte> out) {
+  return encode_into(q, out.data(), out.size());
+}
+
+template <typename UnitTag, typename Rep>
+std::size_t encode_into(QuantitySpan<UnitTag, Rep> values, std::span<std::byte> out) {
+  return encode_into(values, out.data(), out.size());
+}
+
+inline Result<Header> try_read_header(std::span<const std::byte> data) noexcept {
+  return try_read_header(data.data(), data.size());
+}
+
+template <typename T>
+Result<quantity_type_t<T>> try_decode(std::span<const std::byte> data) noexcept {
+  return try_decode<T>(data.data(), data.size());
+}
+
+template <typename T> quantity_type_t<T> decode(std::span<const std::byte> data) {
+  return decode<T>(data.data(), data.size());
+}
+
+template <typename T>
+Result<quantity_array_t<T>> try_decode_array(std::span<const std::byte> data) {
+  return try_decode_array<T>(data.data(), data.size());
+}
+
+template <typename T> quantity_array_t<T> decode_array(std::span<const std::byte> data) {
+  return decode_array<T>(data.data(), data.size());
+}
+
+template <typename T>
+Result<ConstQuantitySpan<typename ExtractTag<T>::type, typename ExtractRep<T>::type>>
+try_decode_view(std::span<const std::byte> data) noexcept {
+  return try_decode_view<T>(data.data(), data.size());
+}
+
+template <typename T>
+ConstQuantitySpan<typename ExtractTag<T>::type, typename ExtractRep<T>::type>
+decode_view(std::span<const std::byte> data) {
+  return decode_view<T>(data.data(), data.size());
+}
+#endif
+
+} // namespace binary
+
+} // namespace qtty
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file converter.hpp
+ * @brief Reusable conversion plans for unit pairs resolved once.
+ *
+ * A Converter resolves a (from, to) unit pair a single time (at compile time
+ * for generated units, through qtty-ffi otherwise) and records the result as
+ * an identity, a scale, or a scale plus offset. Applying it afterwards never
+ * touches the FFI:
+ *
+ * @code
+ * // Input unit chosen at runtime, e.g. from a file header
+ * qtty::Converter<> to_meters(unit_from_config, UNIT_ID_METER);
+ * for (Record &r : records) {
+ *   r.distance = to_meters(r.distance);
+ * }
+ *
+ * // Typed pair: the plan is a compile-time constant
+ * constexpr qtty::Converter<qtty::Kilometer, qtty::Meter> km_to_m;
+ * qtty::Meter m = km_to_m(qtty::Kilometer(1.5));
+ * @endcode
+ */
+
+#include "ffi_core.hpp"
+#include "quantity_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace qtty {
+
+template <typename FromType = void, typename ToType = void> class Converter;
+
+/**
+ * @brief Conversion plan between two runtime unit ids.
+ *
+ * Maps a value `v` in `from()` to `v * scale() + offset()` in `to()`; linear
+ * plans skip the offset and identity plans return `v` unchanged. All
+ * applications are `noexcept`.
+ */
+template <> class Converter<void, void> {
+public:
+  /// How a plan maps its input.
+  enum class Kind : uint8_t { Identity, Linear, Affine };
+
+  /// Identity plan (no unit pair).
+  constexpr Converter() noexcept = default;
+
+  /**
+   * @brief Resolve the `from` → `to` plan.
+   * @throws QttyException and derived exception types on FFI failure (unknown
+   *         unit, incompatible dimensions).
+   */
+  Converter(UnitId from, UnitId to) : Converter() {
+    Result<Converter> plan = try_make(from, to);
+    check_status(plan.status(), "Creating converter");
+    *this = *plan;
+  }
+
+  /// Non-throwing counterpart of Converter(UnitId, UnitId).
+  static Result<Converter> try_make(UnitId from, UnitId to) noexcept {
+    double factor = 0.0;
+    bool linear = false;
+    QttyStatus status = detail::resolve_conversion_factor(from, to, factor, linear);
+    if (status != QTTY_STATUS_OK) {
+      return Result<Converter>::from_status(status);
+    }
+    if (linear) {
+      return Converter(from, to, factor == 1.0 ? Kind::Identity : Kind::Linear, factor, 0.0);
+    }
+
+    // qtty-ffi conversions are affine: f(v) = v * (f(1) - f(0)) + f(0)
+    Result<double> zero = try_convert_value(0.0, from, to);
+    if (!zero) {
+      return Result<Converter>::from_status(zero.status());
+    }
+    return Converter(from, to, Kind::Affine, factor - *zero, *zero);
+  }
+
+  constexpr UnitId from() const noexcept { return m_from; }
+  constexpr UnitId to() const noexcept { return m_to; }
+  constexpr Kind kind() const noexcept { return m_kind; }
+  constexpr bool is_identity() const noexcept { return m_kind == Kind::Identity; }
+  constexpr double scale() const noexcept { return m_scale; }
+  constexpr double offset() const noexcept { return m_offset; }
+
+  /// Convert a single value.
+  constexpr double operator()(double value) const noexcept {
+    switch (m_kind) {
+    case Kind::Identity:
+      return value;
+    case Kind::Linear:
+      return value * m_scale;
+    case Kind::Affine:
+    default:
+      return value * m_scale + m_offset;
+    }
+  }
+
+  /**
+   * @brief Convert @p count values from @p in into @p out.
+   *
+   * Uses the SIMD kernels of qtty/simd/. `in` and `out` may be the same
+   * buffer; partially overlapping ranges are not supported.
+   */
+  void operator()(const double *in, double *out, std::size_t count) const noexcept {
+    switch (m_kind) {
+    case Kind::Identity:
+      if (in != out) {
+        std::copy(in, in + count, out);
+      }
+      break;
+    case Kind::Linear:
+      simd::scale(in, out, count, m_scale);
+      break;
+    case Kind::Affine:
+    default:
+      simd::affine(in, out, count, m_scale, m_offset);
+      break;
+    }
+  }
+
+  /// Convert @p count values in place.
+  void operator()(double *data, std::size_t count) const noexcept { (*this)(data, data, count); }
+
+#if __cplusplus >= 202002L
+  /**
+   * @brief Convert @p in into @p out (which must be at least as large).
+   * @throws QttyException when @p out is smaller than @p in.
+   */
+  void operator()(std::span<const double> in, std::span<double> out) const {
+    if (out.size() < in.size()) {
+      check_status(QTTY_STATUS_BUFFER_TOO_SMALL, "Converter");
+    }
+    (*this)(in.data(), out.data(), in.size());
+  }
+
+  /// Convert @p data in place.
+  void operator()(std::span<double> data) const noexcept { (*this)(data.data(), data.size()); }
+#endif
+
+protected:
+  constexpr Converter(UnitId from, UnitId to, Kind kind, double scale, double offset) noexcept
+      : m_from(from), m_to(to), m_kind(kind), m_scale(scale), m_offset(offset) {}
+
+private:
+  UnitId m_from{};
+  UnitId m_to{};
+  Kind m_kind = Kind::Identity;
+  double m_scale = 1.0;
+  double m_offset = 0.0;
+};
+
+/**
+ * @brief Conversion plan between two unit types known at compile time.
+ *
+ * Accepts tags or Quantity types, like Quantity::to<>(). When the pair has a
+ * compile-time factor the plan is built in a constant expression; otherwise
+ * the constructor resolves it once through qtty-ffi. Adds a typed
+ * Quantity overload to the raw-value overloads of Converter<>.
+ */
+template <typename FromType, typename ToType> class Converter : public Converter<> {
+public:
+  using from_tag = typename ExtractTag<FromType>::type;
+  using to_tag = typename ExtractTag<ToType>::type;
+
+  static_assert(dimensions_compatible<from_tag, to_tag>(),
+                "Cannot convert between units of different dimensions");
+  static_assert(!is_derived_v<from_tag> || has_static_conversion<from_tag, to_tag>(),
+                "Compound Converter requires compile-time factors for every component");
+
+  /**
+   * @brief Resolve the plan.
+   * @throws QttyException on FFI failure (only for pairs without a
+   *         compile-time factor).
+   */
+  constexpr Converter() noexcept(has_static_conversion<from_tag, to_tag>())
+      : Converter<>(make_plan()) {}
+
+  using Converter<>::operator();
+
+  /// Convert a typed quantity; the result keeps its representation.
+  template <typename Rep>
+  constexpr Quantity<to_tag, Rep>
+  operator()(const Quantity<from_tag, Rep> &quantity) const noexcept {
+    return Quantity<to_tag, Rep>(
+        detail::to_rep<Rep>(Converter<>::operator()(static_cast<double>(quantity.value()))));
+  }
+
+  /**
+   * @brief Convert the quantities viewed by @p in into @p out.
+   * @throws QttyException when the views have different sizes.
+   */
+  void operator()(ConstQuantitySpan<from_tag> in, QuantitySpan<to_tag> out) const {
+    detail::check_same_size(in.size(), out.size(), "Converter");
+    Converter<>::operator()(in.raw_data(), out.raw_data(), in.size());
+  }
+
+private:
+  static constexpr Converter<> make_plan() {
+    if constexpr (has_static_conversion<from_tag, to_tag>()) {
+      constexpr double factor = conversion_factor_v<from_tag, to_tag>;
+      return StaticPlan(factor);
+    } else {
+      return Converter<>(UnitTraits<from_tag>::unit_id(), UnitTraits<to_tag>::unit_id());
+    }
+  }
+
+  // Exposes the protected constructor for compile-time plans
+  struct StaticPlan : Converter<> {
+    constexpr explicit StaticPlan(double factor) noexcept
+        : Converter<>(plan_unit_id<from_tag>(), plan_unit_id<to_tag>(),
+                      factor == 1.0 ? Kind::Identity : Kind::Linear, factor, 0.0) {}
+  };
+
+  // Compound, product and power tags have no single unit id
+  template <typename Tag> static constexpr UnitId plan_unit_id() {
+    if constexpr (is_derived_v<Tag>) {
+      return UnitId{};
+    } else {
+      return UnitTraits<Tag>::unit_id();
+    }
+  }
+};
+
+} // namespace qtty
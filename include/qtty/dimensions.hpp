@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+#include "exponents.hpp"
+
+namespace qtty {
+namespace dim {
+
+struct Length {
+  static constexpr Exponents exponents{{1, 0, 0, 0, 0, 0, 0, 0, 0}};
+};
+struct Time {
+  static constexpr Exponents exponents{{0, 0, 1, 0, 0, 0, 0, 0, 0}};
+};
+struct Angle {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 0, 0, 0, 1, 0}};
+};
+struct Mass {
+  static constexpr Exponents exponents{{0, 1, 0, 0, 0, 0, 0, 0, 0}};
+};
+struct Power {
+  static constexpr Exponents exponents{{2, 1, -3, 0, 0, 0, 0, 0, 0}};
+};
+struct Area {
+  static constexpr Exponents exponents{{2, 0, 0, 0, 0, 0, 0, 0, 0}};
+};
+struct Volume {
+  static constexpr Exponents exponents{{3, 0, 0, 0, 0, 0, 0, 0, 0}};
+};
+struct Acceleration {
+  static constexpr Exponents exponents{{1, 0, -2, 0, 0, 0, 0, 0, 0}};
+};
+struct Force {
+  static constexpr Exponents exponents{{1, 1, -2, 0, 0, 0, 0, 0, 0}};
+};
+struct Energy {
+  static constexpr Exponents exponents{{2, 1, -2, 0, 0, 0, 0, 0, 0}};
+};
+struct Pressure {
+  static constexpr Exponents exponents{{-1, 1, -2, 0, 0, 0, 0, 0, 0}};
+};
+struct SolidAngle {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 0, 0, 0, 0, 1}};
+};
+struct Temperature {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 1, 0, 0, 0, 0}};
+};
+struct Radiance {
+  static constexpr Exponents exponents{{0, 1, -3, 0, 0, 0, 0, 0, -1}};
+};
+struct SpectralRadiance {
+  static constexpr Exponents exponents{{-1, 1, -3, 0, 0, 0, 0, 0, -1}};
+};
+struct PhotonRadiance {
+  static constexpr Exponents exponents{{-2, 0, -1, 0, 0, 0, 0, 0, -1}};
+};
+struct SpectralPhotonRadiance {
+  static constexpr Exponents exponents{{-3, 0, -1, 0, 0, 0, 0, 0, -1}};
+};
+struct InverseSolidAngle {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 0, 0, 0, 0, -1}};
+};
+struct LuminousIntensity {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 0, 0, 1, 0, 0}};
+};
+struct LuminousFlux {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 0, 0, 1, 0, 1}};
+};
+struct Illuminance {
+  static constexpr Exponents exponents{{-2, 0, 0, 0, 0, 0, 1, 0, 1}};
+};
+struct Frequency {
+  static constexpr Exponents exponents{{0, 0, -1, 0, 0, 0, 0, 0, 0}};
+};
+struct AmountOfSubstance {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 0, 1, 0, 0, 0}};
+};
+struct Current {
+  static constexpr Exponents exponents{{0, 0, 0, 1, 0, 0, 0, 0, 0}};
+};
+struct Charge {
+  static constexpr Exponents exponents{{0, 0, 1, 1, 0, 0, 0, 0, 0}};
+};
+struct Voltage {
+  static constexpr Exponents exponents{{2, 1, -3, -1, 0, 0, 0, 0, 0}};
+};
+struct Resistance {
+  static constexpr Exponents exponents{{2, 1, -3, -2, 0, 0, 0, 0, 0}};
+};
+struct Capacitance {
+  static constexpr Exponents exponents{{-2, -1, 4, 2, 0, 0, 0, 0, 0}};
+};
+struct Inductance {
+  static constexpr Exponents exponents{{2, 1, -2, -2, 0, 0, 0, 0, 0}};
+};
+struct MagneticFlux {
+  static constexpr Exponents exponents{{2, 1, -2, -1, 0, 0, 0, 0, 0}};
+};
+struct MagneticFluxDensity {
+  static constexpr Exponents exponents{{0, 1, -2, -1, 0, 0, 0, 0, 0}};
+};
+struct Density {
+  static constexpr Exponents exponents{{-3, 1, 0, 0, 0, 0, 0, 0, 0}};
+};
+struct Dimensionless {
+  static constexpr Exponents exponents{{0, 0, 0, 0, 0, 0, 0, 0, 0}};
+};
+
+} // namespace dim
+} // namespace qtty
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file exponents.hpp
+ * @brief Exponent vectors over the SI base dimensions.
+ *
+ * Every `dim::` tag in dimensions.hpp carries the exponents of its coherent
+ * SI unit, e.g. `dim::Energy::exponents` is kg·m²·s⁻². Products, quotients
+ * and powers of units add, subtract and scale these vectors, so two unit
+ * expressions are interconvertible exactly when their vectors are equal:
+ *
+ * @code
+ * static_assert(dim::Force::exponents + dim::Length::exponents == dim::Energy::exponents);
+ * @endcode
+ *
+ * Plane and solid angle are kept as base dimensions of their own (instead of
+ * SI's dimensionless radian and steradian) so that angular quantities never
+ * silently convert to plain numbers or frequencies.
+ */
+
+#include <cstddef>
+
+namespace qtty {
+namespace dim {
+
+/// Index of each base dimension within Exponents::value.
+enum BaseDimension : std::size_t {
+  kLength,
+  kMass,
+  kTime,
+  kCurrent,
+  kTemperature,
+  kAmount,
+  kLuminousIntensity,
+  kPlaneAngle,
+  kSolidAngle,
+  kBaseDimensionCount
+};
+
+/// Exponent of every base dimension, in BaseDimension order.
+struct Exponents {
+  int value[kBaseDimensionCount] = {};
+};
+
+constexpr Exponents operator+(const Exponents &a, const Exponents &b) noexcept {
+  Exponents out;
+  for (std::size_t i = 0; i < kBaseDimensionCount; ++i) {
+    out.value[i] = a.value[i] + b.value[i];
+  }
+  return out;
+}
+
+constexpr Exponents operator-(const Exponents &a, const Exponents &b) noexcept {
+  Exponents out;
+  for (std::size_t i = 0; i < kBaseDimensionCount; ++i) {
+    out.value[i] = a.value[i] - b.value[i];
+  }
+  return out;
+}
+
+constexpr Exponents operator*(const Exponents &a, int power) noexcept {
+  Exponents out;
+  for (std::size_t i = 0; i < kBaseDimensionCount; ++i) {
+    out.value[i] = a.value[i] * power;
+  }
+  return out;
+}
+
+constexpr bool operator==(const Exponents &a, const Exponents &b) noexcept {
+  for (std::size_t i = 0; i < kBaseDimensionCount; ++i) {
+    if (a.value[i] != b.value[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr bool operator!=(const Exponents &a, const Exponents &b) noexcept { return !(a == b); }
+
+/// True when every exponent is zero (a pure number).
+constexpr bool is_dimensionless(const Exponents &a) noexcept { return a == Exponents{}; }
+
+} // namespace dim
+} // namespace qtty
@@ -8,15 +8,31 @@
  * @brief Core quantity template and error translation utilities.
  */
 
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <ostream>
+#include <ratio>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "exponents.hpp"
+#include "ratio.hpp"
+#include "simd/dispatch.hpp"
+
 extern "C" {
 #include "qtty_ffi.h"
 }
@@ -78,6 +94,56 @@ public:
 // exceptions. This provides idiomatic error handling for C++ users while
 // maintaining compatibility with the C FFI boundary.
 
+// When the translation unit is compiled without exception support
+// (-fno-exceptions), failures reaching check_status() print the message to
+// stderr and abort instead; use the non-throwing `try_*` API below to handle
+// them.
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define QTTY_HAS_EXCEPTIONS 1
+#else
+#define QTTY_HAS_EXCEPTIONS 0
+#endif
+
+// Statuses raised by the wrapper itself, outside the range qtty-ffi uses.
+
+/// Encoded input is corrupt or of an unsupported format version.
+inline constexpr QttyStatus kStatusMalformedInput = static_cast<QttyStatus>(-100);
+/// Encoded data is valid but cannot be viewed in place as the requested type.
+inline constexpr QttyStatus kStatusNotViewable = static_cast<QttyStatus>(-101);
+/// A file could not be opened, read or written.
+inline constexpr QttyStatus kStatusIoError = static_cast<QttyStatus>(-102);
+/// No entry (e.g. a column) with the requested name.
+inline constexpr QttyStatus kStatusNotFound = static_cast<QttyStatus>(-103);
+
+/**
+ * @brief Short description of a qtty FFI status code (e.g. "unknown unit").
+ */
+inline const char *status_message(QttyStatus status) noexcept {
+  switch (status) {
+  case QTTY_STATUS_OK:
+    return "ok";
+  case QTTY_STATUS_UNKNOWN_UNIT:
+    return "unknown unit";
+  case QTTY_STATUS_INCOMPATIBLE_DIM:
+    return "incompatible dimensions";
+  case QTTY_STATUS_NULL_OUT:
+    return "null output pointer";
+  case QTTY_STATUS_BUFFER_TOO_SMALL:
+    return "output buffer too small";
+  case kStatusMalformedInput:
+    return "malformed input";
+  case kStatusNotViewable:
+    return "data not viewable as the requested type";
+  case kStatusIoError:
+    return "file I/O failed";
+  case kStatusNotFound:
+    return "not found";
+  default:
+    return "unknown error";
+  }
+}
+
 // Helper function to check status and throw appropriate exceptions
 /**
  * @brief Convert qtty FFI status codes into typed C++ exceptions.
@@ -90,34 +156,147 @@ inline void check_status(QttyStatus status, const char *operation) {
     return;
   }
 
-  std::string msg = std::string(operation) + " failed: ";
+#if QTTY_HAS_EXCEPTIONS
+  std::string msg = std::string(operation) + " failed: " + status_message(status);
   switch (status) {
   case QTTY_STATUS_UNKNOWN_UNIT:
-    throw InvalidUnitError(msg + "unknown unit");
+    throw InvalidUnitError(msg);
   case QTTY_STATUS_INCOMPATIBLE_DIM:
-    throw IncompatibleDimensionsError(msg + "incompatible dimensions");
+    throw IncompatibleDimensionsError(msg);
   case QTTY_STATUS_NULL_OUT:
-    throw NullPointerError(msg + "null output pointer");
-  case QTTY_STATUS_BUFFER_TOO_SMALL:
-    throw QttyException(msg + "output buffer too small");
+    throw NullPointerError(msg);
   default:
-    throw QttyException(msg + "unknown error");
+    throw QttyException(msg);
   }
+#else
+  std::fprintf(stderr, "qtty: %s failed: %s\n", operation, status_message(status));
+  std::abort();
+#endif
 }
 
+// ============================================================================
+// Non-Throwing Results
+// ============================================================================
+// `Result<T>` is the return type of the `try_*` entry points (try_to<>(),
+// try_format(), try_convert_value(), serialization::try_*). It carries either
+// a value or the QttyStatus explaining why there is none, so hot loops and
+// -fno-exceptions builds can branch on the status instead of catching.
+
+/**
+ * @brief A value of type `T` or the QttyStatus of the failure that prevented it.
+ *
+ * A minimal `std::expected<T, QttyStatus>`; `T` must be default-constructible.
+ *
+ * @code
+ * auto km = qtty::Meter(1500.0).try_to<qtty::Kilometer>();
+ * if (km) {
+ *   use(*km);
+ * } else {
+ *   log(qtty::status_message(km.status()));
+ * }
+ * @endcode
+ */
+template <typename T> class Result {
+public:
+  using value_type = T;
+
+  /// Successful result holding @p value.
+  constexpr Result(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : m_value(std::move(value)), m_status(QTTY_STATUS_OK) {}
+
+  /// Failed result carrying @p status (which must not be `QTTY_STATUS_OK`).
+  static Result from_status(QttyStatus status) noexcept(
+      std::is_nothrow_default_constructible_v<T>) {
+    Result result{T{}};
+    result.m_status = status;
+    return result;
+  }
+
+  constexpr bool has_value() const noexcept { return m_status == QTTY_STATUS_OK; }
+  constexpr explicit operator bool() const noexcept { return has_value(); }
+
+  /// `QTTY_STATUS_OK` on success, otherwise the failing status.
+  constexpr QttyStatus status() const noexcept { return m_status; }
+
+  /// Unchecked access; only valid when has_value() is true.
+  constexpr const T &operator*() const & noexcept { return m_value; }
+  constexpr T &operator*() & noexcept { return m_value; }
+  constexpr T &&operator*() && noexcept { return std::move(m_value); }
+  constexpr const T *operator->() const noexcept { return &m_value; }
+  constexpr T *operator->() noexcept { return &m_value; }
+
+  /**
+   * @brief Checked access.
+   * @throws QttyException and derived exception types when there is no value.
+   */
+  const T &value() const & {
+    check_status(m_status, "qtty::Result::value");
+    return m_value;
+  }
+  T &value() & {
+    check_status(m_status, "qtty::Result::value");
+    return m_value;
+  }
+  T &&value() && {
+    check_status(m_status, "qtty::Result::value");
+    return std::move(m_value);
+  }
+
+  /// The value, or @p fallback when there is none.
+  template <typename U> T value_or(U &&fallback) const & {
+    return has_value() ? m_value : static_cast<T>(std::forward<U>(fallback));
+  }
+  template <typename U> T value_or(U &&fallback) && {
+    return has_value() ? std::move(m_value) : static_cast<T>(std::forward<U>(fallback));
+  }
+
+private:
+  T m_value;
+  QttyStatus m_status;
+};
+
 // ============================================================================
 // Forward Declarations and Type Traits
 // ============================================================================
 
 // Forward declarations
-template <typename UnitTag> class Quantity;
+template <typename UnitTag, typename Rep = double> class Quantity;
 template <typename NumeratorTag, typename DenominatorTag> struct CompoundTag;
+template <typename LhsTag, typename RhsTag> struct ProductTag;
+template <typename BaseTag, int Power> struct PowerTag;
 
 // Type trait to detect compound (derived) unit tags
 template <typename T> struct is_compound : std::false_type {};
 template <typename N, typename D> struct is_compound<CompoundTag<N, D>> : std::true_type {};
 template <typename T> inline constexpr bool is_compound_v = is_compound<T>::value;
 
+// Type traits to detect product and power unit tags
+template <typename T> struct is_product : std::false_type {};
+template <typename A, typename B> struct is_product<ProductTag<A, B>> : std::true_type {};
+template <typename T> inline constexpr bool is_product_v = is_product<T>::value;
+
+template <typename T> struct is_power : std::false_type {};
+template <typename T, int P> struct is_power<PowerTag<T, P>> : std::true_type {};
+template <typename T> inline constexpr bool is_power_v = is_power<T>::value;
+
+// Quotient, product and power tags have no single FFI unit id
+template <typename T>
+inline constexpr bool is_derived_v = is_compound_v<T> || is_product_v<T> || is_power_v<T>;
+
+// Numerator/denominator tags of a compound tag
+template <typename T> struct compound_parts;
+template <typename N, typename D> struct compound_parts<CompoundTag<N, D>> {
+  using numerator = N;
+  using denominator = D;
+};
+
+// Factor tags of a product tag
+template <typename T> struct product_parts;
+template <typename A, typename B> struct product_parts<ProductTag<A, B>> {
+  using lhs = A;
+  using rhs = B;
+};
+
 // Template trait to get unit ID from unit tag
 // Each unit tag (e.g., MeterTag) must specialize this template to provide
 // its corresponding C FFI unit ID constant (e.g., UNIT_ID_METER).
@@ -138,10 +317,528 @@ template <typename T> struct ExtractTag {
   using type = T;
 };
 
-template <typename Tag> struct ExtractTag<Quantity<Tag>> {
+template <typename Tag, typename Rep> struct ExtractTag<Quantity<Tag, Rep>> {
   using type = Tag;
 };
 
+// Representation of a Quantity type; `double` for bare tags
+template <typename T> struct ExtractRep {
+  using type = double;
+};
+
+template <typename Tag, typename Rep> struct ExtractRep<Quantity<Tag, Rep>> {
+  using type = Rep;
+};
+
+// Quantity type named by either a tag (double representation) or a Quantity
+template <typename T>
+using quantity_type_t = Quantity<typename ExtractTag<T>::type, typename ExtractRep<T>::type>;
+
+// ============================================================================
+// Representation Types
+// ============================================================================
+// Quantity<Tag, Rep> stores its value as `Rep` (double by default). Any
+// arithmetic type except bool is accepted: float halves the footprint of
+// large columns, long double extends precision, and int32_t / int64_t hold
+// counts and fixed-point readings. Changing representation is implicit only
+// when every value of the source survives it; anything else must be spelled
+// out with rep_cast<>() or an explicit constructor call.
+
+/**
+ * @brief True when every value of `From` is exactly representable in `To`.
+ *
+ * float → double, int32_t → double and int32_t → int64_t qualify;
+ * double → float, int64_t → double and any floating → integral do not.
+ */
+template <typename From, typename To> constexpr bool is_lossless_rep_conversion() {
+  using FromLimits = std::numeric_limits<From>;
+  using ToLimits = std::numeric_limits<To>;
+  if constexpr (std::is_same_v<From, To>) {
+    return true;
+  } else if constexpr (std::is_floating_point_v<To>) {
+    return FromLimits::digits <= ToLimits::digits &&
+           (std::is_integral_v<From> || FromLimits::max_exponent <= ToLimits::max_exponent);
+  } else if constexpr (std::is_integral_v<From>) {
+    return (std::is_unsigned_v<From> || std::is_signed_v<To>) &&
+           FromLimits::digits <= ToLimits::digits;
+  } else {
+    return false;
+  }
+}
+
+template <typename From, typename To>
+inline constexpr bool is_lossless_rep_conversion_v = is_lossless_rep_conversion<From, To>();
+
+namespace detail {
+
+// Unit factors are doubles; values are scaled in at least double precision
+template <typename Rep> using compute_t = std::common_type_t<Rep, double>;
+
+// `value` converted to representation `To`; floating values stored in an
+// integral representation are rounded to nearest (halves away from zero)
+template <typename To, typename From> constexpr To to_rep(From value) noexcept {
+  if constexpr (std::is_integral_v<To> && std::is_floating_point_v<From>) {
+    const To truncated = static_cast<To>(value);
+    const From rest = value - static_cast<From>(truncated);
+    if (rest >= From(0.5)) {
+      return static_cast<To>(truncated + 1);
+    }
+    if (rest <= From(-0.5)) {
+      return static_cast<To>(truncated - 1);
+    }
+    return truncated;
+  } else {
+    return static_cast<To>(value);
+  }
+}
+
+} // namespace detail
+
+// ============================================================================
+// Compile-Time Conversion Factors
+// ============================================================================
+// Generated UnitTraits specializations carry `to_si_factor()`: the value of
+// one unit expressed in the coherent SI unit of its dimension. When both ends
+// of a conversion expose it, the ratio is folded at compile time and
+// Quantity::to<>() reduces to a single multiply. Tags without a factor (for
+// example, user-defined tags or headers built against a newer qtty-ffi) keep
+// going through qtty_quantity_convert().
+
+// Type trait to detect unit tags with a compile-time SI scale factor
+template <typename UnitTag, typename = void> struct has_si_factor : std::false_type {};
+template <typename UnitTag>
+struct has_si_factor<UnitTag, std::void_t<decltype(UnitTraits<UnitTag>::to_si_factor())>>
+    : std::true_type {};
+template <typename UnitTag> inline constexpr bool has_si_factor_v = has_si_factor<UnitTag>::value;
+
+// Type trait to detect unit tags whose SI factor is an exact rational
+// (`using si_ratio = std::ratio<N, D>;`, emitted for exactly defined length,
+// time, area and volume units)
+template <typename UnitTag, typename = void> struct has_si_ratio : std::false_type {};
+template <typename UnitTag>
+struct has_si_ratio<UnitTag, std::void_t<typename UnitTraits<UnitTag>::si_ratio>>
+    : std::true_type {};
+template <typename UnitTag> inline constexpr bool has_si_ratio_v = has_si_ratio<UnitTag>::value;
+
+/**
+ * @brief Dimension code encoded in a unit discriminant.
+ *
+ * qtty-ffi lays unit ids out as `dimension * 10000 + n`, so two units share a
+ * dimension exactly when their codes are equal.
+ */
+constexpr uint32_t dimension_code(UnitId unit) { return static_cast<uint32_t>(unit) / 10000u; }
+
+// Type trait to detect unit tags that declare their dimension (generated
+// units carry `using dimension = dim::Length;` etc., see dimensions.hpp)
+template <typename UnitTag, typename = void> struct has_dimension : std::false_type {};
+template <typename UnitTag>
+struct has_dimension<UnitTag, std::void_t<typename UnitTraits<UnitTag>::dimension>>
+    : std::true_type {};
+template <typename UnitTag> inline constexpr bool has_dimension_v = has_dimension<UnitTag>::value;
+
+// ----------------------------------------------------------------------------
+// SI Exponents and Factors of Unit Expressions
+// ----------------------------------------------------------------------------
+// A simple tag takes its exponent vector from `UnitTraits::dimension` and its
+// scale from `to_si_factor()`. CompoundTag, ProductTag and PowerTag combine
+// those of their components, so every expression built from generated units
+// (e.g. N·m, km/h, s⁻²) knows its dimension and SI factor at compile time.
+
+namespace detail {
+
+template <typename UnitTag, typename = void> struct has_dimension_exponents : std::false_type {};
+template <typename UnitTag>
+struct has_dimension_exponents<
+    UnitTag, std::void_t<decltype(UnitTraits<UnitTag>::dimension::exponents)>> : std::true_type {};
+
+template <typename T> constexpr T integer_power(T base, int power) noexcept {
+  T result = T(1);
+  for (int i = 0; i < (power < 0 ? -power : power); ++i) {
+    result *= base;
+  }
+  return power < 0 ? T(1) / result : result;
+}
+
+template <typename UnitTag> struct si_algebra {
+  static constexpr bool known = has_si_factor_v<UnitTag> && has_dimension_exponents<UnitTag>::value;
+  static constexpr dim::Exponents exponents() { return UnitTraits<UnitTag>::dimension::exponents; }
+  static constexpr double factor() { return UnitTraits<UnitTag>::to_si_factor(); }
+};
+
+template <typename N, typename D> struct si_algebra<CompoundTag<N, D>> {
+  static constexpr bool known = si_algebra<N>::known && si_algebra<D>::known;
+  static constexpr dim::Exponents exponents() {
+    return si_algebra<N>::exponents() - si_algebra<D>::exponents();
+  }
+  static constexpr double factor() { return si_algebra<N>::factor() / si_algebra<D>::factor(); }
+};
+
+template <typename A, typename B> struct si_algebra<ProductTag<A, B>> {
+  static constexpr bool known = si_algebra<A>::known && si_algebra<B>::known;
+  static constexpr dim::Exponents exponents() {
+    return si_algebra<A>::exponents() + si_algebra<B>::exponents();
+  }
+  static constexpr double factor() { return si_algebra<A>::factor() * si_algebra<B>::factor(); }
+};
+
+template <typename T, int P> struct si_algebra<PowerTag<T, P>> {
+  static constexpr bool known = si_algebra<T>::known;
+  static constexpr dim::Exponents exponents() { return si_algebra<T>::exponents() * P; }
+  static constexpr double factor() { return integer_power(si_algebra<T>::factor(), P); }
+};
+
+} // namespace detail
+
+// True when the SI exponents and SI factor of a unit expression are known
+template <typename UnitTag>
+inline constexpr bool has_si_exponents_v = detail::si_algebra<UnitTag>::known;
+
+/// SI exponent vector of a unit expression (requires has_si_exponents_v).
+template <typename UnitTag>
+inline constexpr dim::Exponents si_exponents_v = detail::si_algebra<UnitTag>::exponents();
+
+/// Value of one `UnitTag` in the coherent SI unit of its exponent vector
+/// (requires has_si_exponents_v), e.g. 1e3 / 3.6e3 for km/h.
+template <typename UnitTag>
+inline constexpr double si_factor_v = detail::si_algebra<UnitTag>::factor();
+
+/**
+ * @brief True when the dimensions of both tags are known at compile time.
+ *
+ * Unit expressions with known SI exponents always qualify; other compound
+ * tags are checked component-wise (numerator against numerator, denominator
+ * against denominator).
+ */
+template <typename FromTag, typename ToTag> constexpr bool has_static_dimensions() {
+  if constexpr (has_si_exponents_v<FromTag> && has_si_exponents_v<ToTag>) {
+    return true;
+  } else if constexpr (is_compound_v<FromTag> && is_compound_v<ToTag>) {
+    using From = compound_parts<FromTag>;
+    using To = compound_parts<ToTag>;
+    return has_static_dimensions<typename From::numerator, typename To::numerator>() &&
+           has_static_dimensions<typename From::denominator, typename To::denominator>();
+  } else if constexpr (has_dimension_v<FromTag> && has_dimension_v<ToTag>) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief False when `FromTag` and `ToTag` are known to have different dimensions.
+ *
+ * Unit expressions with known SI exponents are compatible when their
+ * exponent vectors match, so e.g. `ProductTag<NewtonTag, MeterTag>` and
+ * `JouleTag` are. Tags without a declared dimension are assumed compatible
+ * here and are checked by qtty-ffi at runtime instead.
+ */
+template <typename FromTag, typename ToTag> constexpr bool dimensions_compatible() {
+  if constexpr (has_si_exponents_v<FromTag> && has_si_exponents_v<ToTag>) {
+    return si_exponents_v<FromTag> == si_exponents_v<ToTag>;
+  } else if constexpr (is_compound_v<FromTag> && is_compound_v<ToTag>) {
+    using From = compound_parts<FromTag>;
+    using To = compound_parts<ToTag>;
+    return dimensions_compatible<typename From::numerator, typename To::numerator>() &&
+           dimensions_compatible<typename From::denominator, typename To::denominator>();
+  } else if constexpr (has_dimension_v<FromTag> && has_dimension_v<ToTag>) {
+    return std::is_same_v<typename UnitTraits<FromTag>::dimension,
+                          typename UnitTraits<ToTag>::dimension>;
+  } else {
+    return true;
+  }
+}
+
+/**
+ * @brief True when `FromTag` → `ToTag` can be resolved entirely at compile time.
+ *
+ * Both tags must provide `to_si_factor()` and belong to the same dimension.
+ * Unit expressions (quotients, products and powers of such tags) qualify
+ * when their SI exponent vectors match; other compound tags qualify when
+ * their numerators and their denominators do.
+ */
+template <typename FromTag, typename ToTag> constexpr bool has_static_conversion() {
+  if constexpr (has_si_exponents_v<FromTag> && has_si_exponents_v<ToTag>) {
+    return si_exponents_v<FromTag> == si_exponents_v<ToTag>;
+  } else if constexpr (is_compound_v<FromTag> && is_compound_v<ToTag>) {
+    using From = compound_parts<FromTag>;
+    using To = compound_parts<ToTag>;
+    return has_static_conversion<typename From::numerator, typename To::numerator>() &&
+           has_static_conversion<typename From::denominator, typename To::denominator>();
+  } else if constexpr (has_si_factor_v<FromTag> && has_si_factor_v<ToTag>) {
+    return dimension_code(UnitTraits<FromTag>::unit_id()) ==
+           dimension_code(UnitTraits<ToTag>::unit_id());
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief True when every unit involved in `FromTag` → `ToTag` carries an
+ *        exact `si_ratio`.
+ *
+ * Such conversions (including compound ones) are evaluated as one rational
+ * product and rounded to a double once, so e.g. Mile → Inch is exactly 63360
+ * instead of the 63360.00000000001 obtained by dividing the two rounded SI
+ * factors.
+ */
+template <typename FromTag, typename ToTag> constexpr bool has_exact_conversion() {
+  if constexpr (is_compound_v<FromTag> && is_compound_v<ToTag>) {
+    using From = compound_parts<FromTag>;
+    using To = compound_parts<ToTag>;
+    return has_exact_conversion<typename From::numerator, typename To::numerator>() &&
+           has_exact_conversion<typename From::denominator, typename To::denominator>();
+  } else if constexpr (has_si_ratio_v<FromTag> && has_si_ratio_v<ToTag>) {
+    return has_static_conversion<FromTag, ToTag>();
+  } else {
+    return false;
+  }
+}
+
+namespace detail {
+
+template <typename UnitTag> using si_ratio_t = typename UnitTraits<UnitTag>::si_ratio;
+
+// From → To as a single correctly rounded product of the exact ratios
+template <typename FromTag, typename ToTag> constexpr double exact_conversion_factor() {
+  if constexpr (is_compound_v<FromTag>) {
+    // (N / N2) / (D / D2) == (N * D2) / (N2 * D)
+    using N = si_ratio_t<typename compound_parts<FromTag>::numerator>;
+    using D = si_ratio_t<typename compound_parts<FromTag>::denominator>;
+    using N2 = si_ratio_t<typename compound_parts<ToTag>::numerator>;
+    using D2 = si_ratio_t<typename compound_parts<ToTag>::denominator>;
+    return ratio_product<4>({N::num, N2::den, D2::num, D::den},
+                            {N::den, N2::num, D2::den, D::num});
+  } else {
+    using From = si_ratio_t<FromTag>;
+    using To = si_ratio_t<ToTag>;
+    return ratio_product<2>({From::num, To::den}, {From::den, To::num});
+  }
+}
+
+// True when both tags are compound and convert numerator to numerator and
+// denominator to denominator
+template <typename FromTag, typename ToTag> constexpr bool componentwise_conversion() {
+  if constexpr (is_compound_v<FromTag> && is_compound_v<ToTag>) {
+    using From = compound_parts<FromTag>;
+    using To = compound_parts<ToTag>;
+    return has_static_conversion<typename From::numerator, typename To::numerator>() &&
+           has_static_conversion<typename From::denominator, typename To::denominator>();
+  } else {
+    return false;
+  }
+}
+
+template <typename FromTag, typename ToTag> constexpr double static_conversion_factor() {
+  if constexpr (has_exact_conversion<FromTag, ToTag>()) {
+    return exact_conversion_factor<FromTag, ToTag>();
+  } else if constexpr (componentwise_conversion<FromTag, ToTag>()) {
+    // (N → N2) / (D → D2)
+    using From = compound_parts<FromTag>;
+    using To = compound_parts<ToTag>;
+    return static_conversion_factor<typename From::numerator, typename To::numerator>() /
+           static_conversion_factor<typename From::denominator, typename To::denominator>();
+  } else if constexpr (has_si_factor_v<FromTag> && has_si_factor_v<ToTag>) {
+    return UnitTraits<FromTag>::to_si_factor() / UnitTraits<ToTag>::to_si_factor();
+  } else {
+    // Unit expressions of different shape, e.g. N·m → J
+    return si_factor_v<FromTag> / si_factor_v<ToTag>;
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Compile-time factor converting a value in `FromTag` into `ToTag`.
+ *
+ * Only valid when has_static_conversion<FromTag, ToTag>() holds. For compound
+ * tags this is the numerator factor divided by the denominator factor; for
+ * other unit expressions it is the ratio of their SI factors. When
+ * has_exact_conversion<FromTag, ToTag>() holds the factor is the exact
+ * rational result rounded once; otherwise it is derived from the rounded
+ * `to_si_factor()` values.
+ */
+template <typename FromTag, typename ToTag>
+inline constexpr double conversion_factor_v = detail::static_conversion_factor<FromTag, ToTag>();
+
+// ============================================================================
+// Runtime Conversion-Factor Cache
+// ============================================================================
+// Unit pairs without compile-time factors are resolved through the FFI once
+// and the resulting scale is kept in a process-wide open-addressing table.
+// The table is lock-free and read-mostly: a hit is one acquire load of the
+// slot key plus one relaxed load of the factor, so concurrent readers never
+// contend. Slots are only ever claimed (never evicted); when the probe window
+// is full the pair simply keeps going through the FFI.
+//
+// Only linear conversions (0 maps to 0) are cached, so a cached factor always
+// reproduces qtty_quantity_convert() as `value * factor`.
+
+namespace detail {
+
+struct ConversionCacheSlot {
+  // 0 = empty, key | kPendingBit = being filled, key = ready
+  std::atomic<uint64_t> key{0};
+  std::atomic<double> factor{0.0};
+};
+
+inline constexpr std::size_t kConversionCacheSlots = 1024; // power of two
+inline constexpr std::size_t kConversionCacheMaxProbe = 16;
+inline constexpr uint64_t kConversionCachePendingBit = uint64_t{1} << 63;
+
+// Zero-initialized at load time: no guard on the lookup path.
+inline ConversionCacheSlot conversion_cache_slots[kConversionCacheSlots];
+
+// Discriminants are dense codes (dimension*10000+n) well below 2^31, so the
+// packed pair never collides with the empty (0) or pending markers.
+constexpr uint64_t conversion_cache_key(UnitId from, UnitId to) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(from)) << 32) |
+         static_cast<uint32_t>(to);
+}
+
+constexpr std::size_t conversion_cache_index(uint64_t key) {
+  // Fibonacci hashing spreads neighbouring discriminants across the table
+  return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 54) &
+         (kConversionCacheSlots - 1);
+}
+
+inline bool conversion_cache_lookup(UnitId from, UnitId to, double &factor) noexcept {
+  const uint64_t key = conversion_cache_key(from, to);
+  std::size_t index = conversion_cache_index(key);
+  for (std::size_t probe = 0; probe < kConversionCacheMaxProbe; ++probe) {
+    const ConversionCacheSlot &slot = conversion_cache_slots[index];
+    const uint64_t current = slot.key.load(std::memory_order_acquire);
+    if (current == key) {
+      factor = slot.factor.load(std::memory_order_relaxed);
+      return true;
+    }
+    if (current == 0) {
+      return false;
+    }
+    index = (index + 1) & (kConversionCacheSlots - 1);
+  }
+  return false;
+}
+
+inline void conversion_cache_insert(UnitId from, UnitId to, double factor) noexcept {
+  const uint64_t key = conversion_cache_key(from, to);
+  const uint64_t pending = key | kConversionCachePendingBit;
+  std::size_t index = conversion_cache_index(key);
+  for (std::size_t probe = 0; probe < kConversionCacheMaxProbe; ++probe) {
+    ConversionCacheSlot &slot = conversion_cache_slots[index];
+    uint64_t current = slot.key.load(std::memory_order_relaxed);
+    if (current == 0 &&
+        slot.key.compare_exchange_strong(current, pending, std::memory_order_acq_rel)) {
+      slot.factor.store(factor, std::memory_order_relaxed);
+      slot.key.store(key, std::memory_order_release);
+      return;
+    }
+    if (current == key || current == pending) {
+      return; // another thread already published (or is publishing) it
+    }
+    index = (index + 1) & (kConversionCacheSlots - 1);
+  }
+}
+
+/**
+ * @brief Resolve the scale of a `from` → `to` conversion without throwing.
+ *
+ * Served from the cache when possible; otherwise queried through the FFI and
+ * published. On success, @p linear tells whether the conversion is purely
+ * multiplicative (only then is @p factor meaningful).
+ */
+inline QttyStatus resolve_conversion_factor(UnitId from, UnitId to, double &factor,
+                                            bool &linear) noexcept {
+  if (conversion_cache_lookup(from, to, factor)) {
+    linear = true;
+    return QTTY_STATUS_OK;
+  }
+
+  qtty_quantity_t src_qty;
+  qtty_quantity_t dst_qty;
+  QttyStatus status = qtty_quantity_make(1.0, from, &src_qty);
+  if (status != QTTY_STATUS_OK) {
+    return status;
+  }
+  status = qtty_quantity_convert(src_qty, to, &dst_qty);
+  if (status != QTTY_STATUS_OK) {
+    return status;
+  }
+  factor = dst_qty.value;
+
+  // Cache the pair only if the conversion is purely multiplicative
+  qtty_quantity_t zero_src;
+  qtty_quantity_t zero_dst;
+  linear = qtty_quantity_make(0.0, from, &zero_src) == QTTY_STATUS_OK &&
+           qtty_quantity_convert(zero_src, to, &zero_dst) == QTTY_STATUS_OK &&
+           zero_dst.value == 0.0;
+  if (linear) {
+    conversion_cache_insert(from, to, factor);
+  }
+  return QTTY_STATUS_OK;
+}
+
+/**
+ * @brief Resolve the scale of a linear `from` → `to` conversion.
+ *
+ * Returns false when the conversion is not purely multiplicative.
+ *
+ * @throws QttyException and derived exception types on FFI failure.
+ */
+inline bool linear_conversion_factor(UnitId from, UnitId to, double &factor) {
+  bool linear = false;
+  check_status(resolve_conversion_factor(from, to, factor, linear), "Converting units");
+  return linear;
+}
+
+} // namespace detail
+
+/**
+ * @brief Convert a raw value between two runtime unit ids without throwing.
+ *
+ * Same lookup strategy as convert_value(); failures are reported through the
+ * returned status.
+ */
+inline Result<double> try_convert_value(double value, UnitId from, UnitId to) noexcept {
+  double factor = 0.0;
+  bool linear = false;
+  QttyStatus status = detail::resolve_conversion_factor(from, to, factor, linear);
+  if (status != QTTY_STATUS_OK) {
+    return Result<double>::from_status(status);
+  }
+  if (linear) {
+    return value * factor;
+  }
+
+  qtty_quantity_t src_qty;
+  qtty_quantity_t dst_qty;
+  status = qtty_quantity_make(value, from, &src_qty);
+  if (status == QTTY_STATUS_OK) {
+    status = qtty_quantity_convert(src_qty, to, &dst_qty);
+  }
+  if (status != QTTY_STATUS_OK) {
+    return Result<double>::from_status(status);
+  }
+  return dst_qty.value;
+}
+
+/**
+ * @brief Convert a raw value between two runtime unit ids.
+ *
+ * The first conversion of a (from, to) pair queries qtty-ffi; later
+ * conversions of the same pair are a cache lookup plus one multiply.
+ *
+ * @param value Value expressed in @p from.
+ * @param from  Source unit id.
+ * @param to    Target unit id.
+ * @return Value expressed in @p to.
+ * @throws QttyException and derived exception types on FFI failure.
+ */
+inline double convert_value(double value, UnitId from, UnitId to) {
+  Result<double> result = try_convert_value(value, from, to);
+  check_status(result.status(), "Converting units");
+  return *result;
+}
+
 // ============================================================================
 // Quantity Template Class
 // ============================================================================
@@ -154,69 +851,138 @@ template <typename Tag> struct ExtractTag<Quantity<Tag>> {
 // - constexpr constructors enable compile-time quantity creation
 // - explicit constructor prevents implicit double-to-Quantity conversions
 // - Conversions go through the Rust FFI layer for correctness
+// - The value is stored as `Rep` (see "Representation Types" above), so
+//   sizeof(Quantity<Tag, Rep>) == sizeof(Rep)
 
 // Base Quantity template class
-template <typename UnitTag> class Quantity {
+template <typename UnitTag, typename Rep> class Quantity {
+  static_assert(std::is_arithmetic_v<Rep> && !std::is_same_v<Rep, bool>,
+                "Quantity representation must be an arithmetic type other than bool");
+
 private:
-  double m_value;
+  Rep m_value;
 
 public:
   using unit_tag = UnitTag;
+  using rep = Rep;
 
   // Constructors
-  constexpr Quantity() : m_value(0.0) {}
-  constexpr explicit Quantity(double value) : m_value(value) {}
+  constexpr Quantity() noexcept : m_value(0) {}
+
+  // From a raw value; a floating value never initializes an integral
+  // representation implicitly (use rep_cast<>() to round)
+  template <typename Value,
+            std::enable_if_t<std::is_arithmetic_v<Value> &&
+                                 (std::is_floating_point_v<Rep> || std::is_integral_v<Value>),
+                             int> = 0>
+  constexpr explicit Quantity(Value value) noexcept : m_value(static_cast<Rep>(value)) {}
+
+  // From the same unit in another representation: implicit when lossless
+  template <typename OtherRep,
+            std::enable_if_t<!std::is_same_v<OtherRep, Rep> &&
+                                 is_lossless_rep_conversion_v<OtherRep, Rep>,
+                             int> = 0>
+  constexpr Quantity(const Quantity<UnitTag, OtherRep> &other) noexcept
+      : m_value(static_cast<Rep>(other.value())) {}
+
+  // ... and explicit (rounding to nearest for integral Rep) when it narrows
+  template <typename OtherRep,
+            std::enable_if_t<!is_lossless_rep_conversion_v<OtherRep, Rep>, int> = 0>
+  constexpr explicit Quantity(const Quantity<UnitTag, OtherRep> &other) noexcept
+      : m_value(detail::to_rep<Rep>(other.value())) {}
 
   // Get the unit ID for this quantity type
   static constexpr UnitId unit_id() { return UnitTraits<UnitTag>::unit_id(); }
 
   // Get the raw value
-  constexpr double value() const { return m_value; }
+  constexpr Rep value() const noexcept { return m_value; }
 
   // ========================================================================
   // Unit Conversion
   // ========================================================================
   // Converts this quantity to a different unit of the same dimension.
-  // The conversion is performed by the Rust qtty-ffi library to ensure
-  // correctness and consistency with the authoritative conversion factors.
+  // When both unit tags carry a generated `to_si_factor()`, the conversion is
+  // a single multiply by a factor folded at compile time (and the whole call
+  // is usable in constant expressions). Otherwise the conversion is performed
+  // by the Rust qtty-ffi library.
   //
   // Accepts either a tag type (e.g., KilometerTag) or a Quantity type
-  // (e.g., Kilometer) for convenience, thanks to the ExtractTag helper.
+  // (e.g., Kilometer) for convenience, thanks to the ExtractTag helper. The
+  // result keeps this quantity's representation; the value is scaled in at
+  // least double precision and rounded back to `Rep` once.
   //
-  // Throws IncompatibleDimensionsError if attempting to convert between
-  // different dimensions (e.g., length to time).
+  // Converting between different dimensions (e.g., length to time) is a
+  // compile error when both tags declare their dimension, which every
+  // generated unit does. Tags without a dimension are checked by the FFI and
+  // throw IncompatibleDimensionsError. The call is `noexcept` only when the
+  // factor is known at compile time; the FFI path can always throw.
 
   // Convert to another unit type (accepts either Tag or Quantity<Tag>)
-  template <typename TargetType> Quantity<typename ExtractTag<TargetType>::type> to() const {
+  template <typename TargetType>
+  constexpr Quantity<typename ExtractTag<TargetType>::type, Rep> to() const
+      noexcept(has_static_conversion<UnitTag, typename ExtractTag<TargetType>::type>()) {
     using TargetTag = typename ExtractTag<TargetType>::type;
+    static_assert(dimensions_compatible<UnitTag, TargetTag>(),
+                  "Cannot convert between units of different dimensions");
+
+    if constexpr (has_static_conversion<UnitTag, TargetTag>()) {
+      // Both factors are known: one multiply, no FFI round trip
+      return Quantity<TargetTag, Rep>(detail::to_rep<Rep>(
+          static_cast<detail::compute_t<Rep>>(m_value) * conversion_factor_v<UnitTag, TargetTag>));
+    } else {
+      // FFI conversion (memoized per unit pair for simple units)
+      Result<Quantity<TargetTag, Rep>> result = try_to<TargetTag>();
+      check_status(result.status(), "Converting units");
+      return *result;
+    }
+  }
 
-    if constexpr (is_compound_v<UnitTag>) {
+  /**
+   * @brief Non-throwing counterpart of to<>().
+   *
+   * Returns the converted quantity, or the QttyStatus of the failure (e.g.
+   * `QTTY_STATUS_INCOMPATIBLE_DIM`) without building a message or throwing.
+   */
+  template <typename TargetType>
+  Result<Quantity<typename ExtractTag<TargetType>::type, Rep>> try_to() const noexcept {
+    using TargetTag = typename ExtractTag<TargetType>::type;
+    using Target = Quantity<TargetTag, Rep>;
+    static_assert(dimensions_compatible<UnitTag, TargetTag>(),
+                  "Cannot convert between units of different dimensions");
+
+    if constexpr (has_static_conversion<UnitTag, TargetTag>()) {
+      return to<TargetTag>();
+    } else if constexpr (is_product_v<UnitTag> || is_power_v<UnitTag> ||
+                         is_product_v<TargetTag> || is_power_v<TargetTag>) {
+      // qtty-ffi has no product or power quantities
+      static_assert(has_static_conversion<UnitTag, TargetTag>(),
+                    "Product and power units convert only through compile-time factors");
+      return Result<Target>::from_status(QTTY_STATUS_INCOMPATIBLE_DIM);
+    } else if constexpr (is_compound_v<UnitTag>) {
       // Compound → compound conversion via qtty_derived_convert
       static_assert(is_compound_v<TargetTag>, "Cannot convert compound unit to simple unit");
       qtty_derived_quantity_t src_qty;
       qtty_derived_quantity_t dst_qty;
 
-      QttyStatus status = qtty_derived_make(m_value, UnitTraits<UnitTag>::numerator_unit_id(),
-                                            UnitTraits<UnitTag>::denominator_unit_id(), &src_qty);
-      check_status(status, "Creating derived source quantity");
-
-      status = qtty_derived_convert(src_qty, UnitTraits<TargetTag>::numerator_unit_id(),
-                                    UnitTraits<TargetTag>::denominator_unit_id(), &dst_qty);
-      check_status(status, "Converting derived units");
-
-      return Quantity<TargetTag>(dst_qty.value);
+      QttyStatus status =
+          qtty_derived_make(static_cast<double>(m_value), UnitTraits<UnitTag>::numerator_unit_id(),
+                            UnitTraits<UnitTag>::denominator_unit_id(), &src_qty);
+      if (status == QTTY_STATUS_OK) {
+        status = qtty_derived_convert(src_qty, UnitTraits<TargetTag>::numerator_unit_id(),
+                                      UnitTraits<TargetTag>::denominator_unit_id(), &dst_qty);
+      }
+      if (status != QTTY_STATUS_OK) {
+        return Result<Target>::from_status(status);
+      }
+      return Target(detail::to_rep<Rep>(dst_qty.value));
     } else {
-      // Simple unit conversion via qtty_quantity_convert
-      qtty_quantity_t src_qty;
-      qtty_quantity_t dst_qty;
-
-      QttyStatus status = qtty_quantity_make(m_value, unit_id(), &src_qty);
-      check_status(status, "Creating source quantity");
-
-      status = qtty_quantity_convert(src_qty, UnitTraits<TargetTag>::unit_id(), &dst_qty);
-      check_status(status, "Converting units");
-
-      return Quantity<TargetTag>(dst_qty.value);
+      // Simple unit conversion via the FFI, memoized per unit pair
+      Result<double> value = try_convert_value(static_cast<double>(m_value), unit_id(),
+                                               UnitTraits<TargetTag>::unit_id());
+      if (!value) {
+        return Result<Target>::from_status(value.status());
+      }
+      return Target(detail::to_rep<Rep>(*value));
     }
   }
 
@@ -236,15 +1002,29 @@ public:
   // Scalar Operations
   // ========================================================================
   // Multiplying or dividing a quantity by a scalar preserves the unit.
-  // E.g., 10 meters * 2 = 20 meters
+  // E.g., 10 meters * 2 = 20 meters. The result representation is the
+  // common type of `Rep` and the scalar, so `Quantity<Tag, float> * 2.0f`
+  // stays float while `* 2.0` widens to double.
 
   // Scalar multiplication and division
-  Quantity operator*(double scalar) const { return Quantity(m_value * scalar); }
+  template <typename Scalar, typename = std::enable_if_t<std::is_arithmetic_v<Scalar>>>
+  constexpr Quantity<UnitTag, std::common_type_t<Rep, Scalar>> operator*(Scalar scalar) const {
+    using R = std::common_type_t<Rep, Scalar>;
+    return Quantity<UnitTag, R>(static_cast<R>(static_cast<R>(m_value) * static_cast<R>(scalar)));
+  }
 
-  Quantity operator/(double scalar) const { return Quantity(m_value / scalar); }
+  template <typename Scalar, typename = std::enable_if_t<std::is_arithmetic_v<Scalar>>>
+  constexpr Quantity<UnitTag, std::common_type_t<Rep, Scalar>> operator/(Scalar scalar) const {
+    using R = std::common_type_t<Rep, Scalar>;
+    return Quantity<UnitTag, R>(static_cast<R>(static_cast<R>(m_value) / static_cast<R>(scalar)));
+  }
 
   // Friend function for scalar * quantity
-  friend Quantity operator*(double scalar, const Quantity &q) { return q * scalar; }
+  template <typename Scalar, typename = std::enable_if_t<std::is_arithmetic_v<Scalar>>>
+  friend constexpr Quantity<UnitTag, std::common_type_t<Rep, Scalar>>
+  operator*(Scalar scalar, const Quantity &q) {
+    return q * scalar;
+  }
 
   // ========================================================================
   // Comparison Operators
@@ -282,13 +1062,57 @@ public:
     return *this;
   }
 
-  Quantity &operator*=(double scalar) {
-    m_value *= scalar;
+  // Scaling in place computes in the common type of Rep and the scalar and
+  // rounds once. A floating scalar on an integral Rep would truncate, so it
+  // does not compile (as with the constructors); use rep_cast<>() or `q * s`.
+  template <typename Scalar,
+            std::enable_if_t<std::is_arithmetic_v<Scalar> &&
+                                 !(std::is_integral_v<Rep> && std::is_floating_point_v<Scalar>),
+                             int> = 0>
+  Quantity &operator*=(Scalar scalar) {
+    m_value = static_cast<Rep>(m_value * scalar);
     return *this;
   }
 
-  Quantity &operator/=(double scalar) {
-    m_value /= scalar;
+  template <typename Scalar,
+            std::enable_if_t<std::is_arithmetic_v<Scalar> &&
+                                 !(std::is_integral_v<Rep> && std::is_floating_point_v<Scalar>),
+                             int> = 0>
+  Quantity &operator/=(Scalar scalar) {
+    m_value = static_cast<Rep>(m_value / scalar);
+    return *this;
+  }
+
+  // Mixed-unit compound assignment: `other` is scaled into this unit by a
+  // compile-time factor (see "Mixed-Unit Arithmetic" below). Its
+  // representation must convert losslessly into `Rep`.
+  template <typename OtherTag, typename OtherRep,
+            typename = std::enable_if_t<
+                !(std::is_same_v<OtherTag, UnitTag> && std::is_same_v<OtherRep, Rep>) &&
+                (std::is_same_v<OtherTag, UnitTag> || has_static_conversion<OtherTag, UnitTag>()) &&
+                is_lossless_rep_conversion_v<OtherRep, Rep>>>
+  constexpr Quantity &operator+=(const Quantity<OtherTag, OtherRep> &other) noexcept {
+    if constexpr (std::is_same_v<OtherTag, UnitTag>) {
+      m_value += static_cast<Rep>(other.value());
+    } else {
+      m_value = detail::to_rep<Rep>(m_value + static_cast<detail::compute_t<Rep>>(other.value()) *
+                                                  conversion_factor_v<OtherTag, UnitTag>);
+    }
+    return *this;
+  }
+
+  template <typename OtherTag, typename OtherRep,
+            typename = std::enable_if_t<
+                !(std::is_same_v<OtherTag, UnitTag> && std::is_same_v<OtherRep, Rep>) &&
+                (std::is_same_v<OtherTag, UnitTag> || has_static_conversion<OtherTag, UnitTag>()) &&
+                is_lossless_rep_conversion_v<OtherRep, Rep>>>
+  constexpr Quantity &operator-=(const Quantity<OtherTag, OtherRep> &other) noexcept {
+    if constexpr (std::is_same_v<OtherTag, UnitTag>) {
+      m_value -= static_cast<Rep>(other.value());
+    } else {
+      m_value = detail::to_rep<Rep>(m_value - static_cast<detail::compute_t<Rep>>(other.value()) *
+                                                  conversion_factor_v<OtherTag, UnitTag>);
+    }
     return *this;
   }
 
@@ -316,7 +1140,8 @@ public:
   //   {:.4E}           format(4,  QTTY_FMT_UPPER_EXP)
   //
   // The formatting logic lives in the Rust qtty-ffi library, so precision
-  // semantics are identical on both sides of the FFI boundary.
+  // semantics are identical on both sides of the FFI boundary. The value
+  // crosses the boundary as a double whatever `Rep` is.
 
   /**
    * @brief Format this quantity as a string.
@@ -334,9 +1159,23 @@ public:
    * @throws QttyException on formatting failure.
    */
   std::string format(int precision = -1, uint32_t flags = QTTY_FMT_DEFAULT) const {
+    Result<std::string> result = try_format(precision, flags);
+    check_status(result.status(), "format");
+    return std::move(*result);
+  }
+
+  /**
+   * @brief Non-throwing counterpart of format().
+   *
+   * Failures are reported through the returned status; only allocation
+   * failure can still throw.
+   */
+  Result<std::string> try_format(int precision = -1, uint32_t flags = QTTY_FMT_DEFAULT) const {
     qtty_quantity_t qty;
-    QttyStatus make_status = qtty_quantity_make(m_value, unit_id(), &qty);
-    check_status(make_status, "format: creating quantity");
+    QttyStatus status = qtty_quantity_make(static_cast<double>(m_value), unit_id(), &qty);
+    if (status != QTTY_STATUS_OK) {
+      return Result<std::string>::from_status(status);
+    }
 
     char buf[512];
     QttyStatus result = qtty_quantity_format(qty, precision, flags, buf, sizeof(buf));
@@ -345,17 +1184,294 @@ public:
       char big_buf[4096];
       result = qtty_quantity_format(qty, precision, flags, big_buf, sizeof(big_buf));
       if (result < 0) {
-        throw QttyException("format: buffer too small even at 4096 bytes");
+        return Result<std::string>::from_status(result);
       }
       return std::string(big_buf);
     }
     if (result < 0) {
-      check_status(result, "format: formatting quantity");
+      return Result<std::string>::from_status(result);
     }
     return std::string(buf);
   }
 };
 
+// ============================================================================
+// Mixed-Unit Arithmetic and Comparison
+// ============================================================================
+// Quantities of different units in the same dimension can be added,
+// subtracted and compared directly when both units have compile-time
+// factors. The result (or comparison) unit is the finer of the two, so only
+// the coarser operand is scaled: `1.0_km + 250.0_m` is one multiply-add
+// yielding `Meter(1250.0)`, and `dist_m < limit_km` is one multiply and one
+// compare. No FFI call is involved.
+//
+// Operands may also differ in representation (including two representations
+// of one unit): results use their common type, so float + double is double,
+// and comparisons never round either side.
+
+/**
+ * @brief The unit in which two statically convertible units are combined.
+ *
+ * The finer unit (smaller SI factor) of `A` and `B`; `A` on ties.
+ */
+template <typename A, typename B> struct common_unit {
+  using type = std::conditional_t<(conversion_factor_v<A, B> <= 1.0), A, B>;
+};
+template <typename A> struct common_unit<A, A> {
+  using type = A;
+};
+template <typename A, typename B> using common_unit_t = typename common_unit<A, B>::type;
+
+namespace detail {
+
+// Enables the mixed operators for distinct, statically convertible tags, and
+// for one tag held in two representations
+template <typename A, typename RA, typename B, typename RB>
+using enable_mixed_units_t =
+    std::enable_if_t<!(std::is_same_v<A, B> && std::is_same_v<RA, RB>) &&
+                         (std::is_same_v<A, B> || has_static_conversion<A, B>()),
+                     int>;
+
+// Value of `q` expressed in `Target` (no multiply when already there)
+template <typename Target, typename Tag, typename Rep>
+constexpr auto value_in(const Quantity<Tag, Rep> &q) noexcept {
+  if constexpr (std::is_same_v<Tag, Target>) {
+    return q.value();
+  } else {
+    return static_cast<compute_t<Rep>>(q.value()) * conversion_factor_v<Tag, Target>;
+  }
+}
+
+// Type in which two values are compared without rounding either
+template <typename RA, typename RB, typename A, typename B>
+using compare_t = std::conditional_t<std::is_same_v<A, B>, std::common_type_t<RA, RB>,
+                                     std::common_type_t<RA, RB, double>>;
+
+} // namespace detail
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr Quantity<common_unit_t<A, B>, std::common_type_t<RA, RB>>
+operator+(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using R = std::common_type_t<RA, RB>;
+  return Quantity<C, R>(detail::to_rep<R>(detail::value_in<C>(lhs) + detail::value_in<C>(rhs)));
+}
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr Quantity<common_unit_t<A, B>, std::common_type_t<RA, RB>>
+operator-(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using R = std::common_type_t<RA, RB>;
+  return Quantity<C, R>(detail::to_rep<R>(detail::value_in<C>(lhs) - detail::value_in<C>(rhs)));
+}
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr bool operator==(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using T = detail::compare_t<RA, RB, A, B>;
+  return static_cast<T>(detail::value_in<C>(lhs)) == static_cast<T>(detail::value_in<C>(rhs));
+}
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr bool operator!=(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using T = detail::compare_t<RA, RB, A, B>;
+  return static_cast<T>(detail::value_in<C>(lhs)) != static_cast<T>(detail::value_in<C>(rhs));
+}
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr bool operator<(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using T = detail::compare_t<RA, RB, A, B>;
+  return static_cast<T>(detail::value_in<C>(lhs)) < static_cast<T>(detail::value_in<C>(rhs));
+}
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr bool operator>(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using T = detail::compare_t<RA, RB, A, B>;
+  return static_cast<T>(detail::value_in<C>(lhs)) > static_cast<T>(detail::value_in<C>(rhs));
+}
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr bool operator<=(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using T = detail::compare_t<RA, RB, A, B>;
+  return static_cast<T>(detail::value_in<C>(lhs)) <= static_cast<T>(detail::value_in<C>(rhs));
+}
+
+template <typename A, typename RA, typename B, typename RB,
+          detail::enable_mixed_units_t<A, RA, B, RB> = 0>
+constexpr bool operator>=(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using C = common_unit_t<A, B>;
+  using T = detail::compare_t<RA, RB, A, B>;
+  return static_cast<T>(detail::value_in<C>(lhs)) >= static_cast<T>(detail::value_in<C>(rhs));
+}
+
+/**
+ * @brief Change the representation of a quantity, keeping its unit.
+ *
+ * The explicit spelling of a narrowing conversion: floating values stored
+ * in an integral representation are rounded to nearest (halves away from
+ * zero), e.g. `rep_cast<int32_t>(Meter(2.5))` is 3 m.
+ *
+ * @code
+ * Quantity<MeterTag, float> reading = rep_cast<float>(1.5_km.to<Meter>());
+ * @endcode
+ */
+template <typename ToRep, typename UnitTag, typename Rep>
+constexpr Quantity<UnitTag, ToRep> rep_cast(const Quantity<UnitTag, Rep> &q) noexcept {
+  return Quantity<UnitTag, ToRep>(q);
+}
+
+// ============================================================================
+// Dimensional Algebra: Products, Quotients and Powers
+// ============================================================================
+// Multiplying or dividing two quantities yields a quantity of the product
+// (ProductTag<A, B>) or quotient (CompoundTag<A, B>) unit; pow<P>() yields
+// PowerTag<Tag, P>. Results are simplified at compile time:
+//
+//   (km/h) * h   → Kilometer          (N / D) * D → N
+//   (N·m) / m    → Newton             (A · B) / B → A
+//   km / (km/h)  → Hour               N / (N / D) → D
+//   m / km, Hz*s → double             dimensionless results are plain numbers
+//
+// where an operand may be in any unit statically convertible to the one it
+// cancels (e.g. `(km/h) * min` → Kilometer). Anything else keeps the product
+// or quotient tag, which converts to every unit with the same SI exponents
+// through one compile-time factor, e.g. `(force * distance).to<Joule>()`.
+// No FFI call is involved.
+
+namespace detail {
+
+// True when a value in `From` can be re-expressed in `To` at compile time
+template <typename From, typename To> constexpr bool reexpressible() {
+  return std::is_same_v<From, To> || has_static_conversion<From, To>();
+}
+
+// True when `Q` is N / D and `R` cancels D
+template <typename Q, typename R> constexpr bool cancels_denominator() {
+  if constexpr (is_compound_v<Q>) {
+    return reexpressible<R, typename compound_parts<Q>::denominator>();
+  } else {
+    return false;
+  }
+}
+
+// True when `Q` is N / D and `R` cancels N
+template <typename R, typename Q> constexpr bool cancels_numerator() {
+  if constexpr (is_compound_v<Q>) {
+    return reexpressible<R, typename compound_parts<Q>::numerator>();
+  } else {
+    return false;
+  }
+}
+
+// True when `P` is A · B and `R` cancels B (Rhs) or A (!Rhs)
+template <typename P, typename R, bool Rhs> constexpr bool cancels_factor() {
+  if constexpr (is_product_v<P>) {
+    using Parts = product_parts<P>;
+    return reexpressible<R, std::conditional_t<Rhs, typename Parts::rhs, typename Parts::lhs>>();
+  } else {
+    return false;
+  }
+}
+
+template <typename A, typename B> constexpr bool dimensionless_product() {
+  if constexpr (has_si_exponents_v<A> && has_si_exponents_v<B>) {
+    return dim::is_dimensionless(si_exponents_v<A> + si_exponents_v<B>);
+  } else {
+    return false;
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Product of two quantities.
+ *
+ * Returns `Quantity<ProductTag<A, B>>`, the cancelled unit for `(N / D) * D`,
+ * or a plain number when the product is dimensionless. The representation is
+ * the common type of both operands'.
+ */
+template <typename A, typename RA, typename B, typename RB>
+constexpr auto operator*(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using R = std::common_type_t<RA, RB>;
+  if constexpr (detail::cancels_denominator<A, B>()) {
+    using Parts = compound_parts<A>;
+    return Quantity<typename Parts::numerator, R>(
+        detail::to_rep<R>(lhs.value() * detail::value_in<typename Parts::denominator>(rhs)));
+  } else if constexpr (detail::cancels_denominator<B, A>()) {
+    using Parts = compound_parts<B>;
+    return Quantity<typename Parts::numerator, R>(
+        detail::to_rep<R>(detail::value_in<typename Parts::denominator>(lhs) * rhs.value()));
+  } else if constexpr (detail::dimensionless_product<A, B>()) {
+    constexpr double factor = si_factor_v<A> * si_factor_v<B>;
+    return detail::to_rep<R>(static_cast<detail::compute_t<R>>(lhs.value()) * rhs.value() *
+                             factor);
+  } else {
+    return Quantity<ProductTag<A, B>, R>(static_cast<R>(static_cast<R>(lhs.value()) * rhs.value()));
+  }
+}
+
+/**
+ * @brief Quotient of two quantities.
+ *
+ * Returns `Quantity<CompoundTag<A, B>>` (e.g. `distance / time` is a
+ * velocity), the cancelled unit for `(A · B) / B` and `N / (N / D)`, or a
+ * plain number when both operands have the same dimension. The
+ * representation is the common type of both operands'.
+ */
+template <typename A, typename RA, typename B, typename RB>
+constexpr auto operator/(const Quantity<A, RA> &lhs, const Quantity<B, RB> &rhs) noexcept {
+  using R = std::common_type_t<RA, RB>;
+  if constexpr (detail::reexpressible<A, B>()) {
+    return detail::to_rep<R>(detail::value_in<B>(lhs) / static_cast<R>(rhs.value()));
+  } else if constexpr (detail::cancels_factor<A, B, true>()) {
+    using Parts = product_parts<A>;
+    return Quantity<typename Parts::lhs, R>(
+        detail::to_rep<R>(lhs.value() / detail::value_in<typename Parts::rhs>(rhs)));
+  } else if constexpr (detail::cancels_factor<A, B, false>()) {
+    using Parts = product_parts<A>;
+    return Quantity<typename Parts::rhs, R>(
+        detail::to_rep<R>(lhs.value() / detail::value_in<typename Parts::lhs>(rhs)));
+  } else if constexpr (detail::cancels_numerator<A, B>()) {
+    using Parts = compound_parts<B>;
+    return Quantity<typename Parts::denominator, R>(
+        detail::to_rep<R>(detail::value_in<typename Parts::numerator>(lhs) / rhs.value()));
+  } else {
+    return Quantity<CompoundTag<A, B>, R>(
+        static_cast<R>(static_cast<R>(lhs.value()) / rhs.value()));
+  }
+}
+
+/**
+ * @brief Integer power of a quantity.
+ *
+ * `pow<2>(Meter(3.0))` is `Quantity<PowerTag<MeterTag, 2>>(9.0)`, convertible
+ * to `SquareMeter` at compile time. `pow<1>` returns the quantity itself and
+ * `pow<0>` returns `1`. Negative powers need a floating-point representation.
+ */
+template <int Power, typename UnitTag, typename Rep>
+constexpr auto pow(const Quantity<UnitTag, Rep> &q) noexcept {
+  static_assert(Power >= 0 || std::is_floating_point_v<Rep>,
+                "Negative powers need a floating-point representation");
+  if constexpr (Power == 0) {
+    return Rep(1);
+  } else if constexpr (Power == 1) {
+    return q;
+  } else {
+    return Quantity<PowerTag<UnitTag, Power>, Rep>(detail::integer_power(q.value(), Power));
+  }
+}
+
 // ============================================================================
 // Stream Insertion Operator
 // ============================================================================
@@ -372,18 +1488,205 @@ public:
 //
 // For `std::format` (C++20) see the std::formatter specialisation below.
 
-template <typename UnitTag> std::ostream &operator<<(std::ostream &os, const Quantity<UnitTag> &q) {
-  os << q.value() << " " << UnitTraits<UnitTag>::symbol();
+template <typename UnitTag, typename Rep>
+std::ostream &operator<<(std::ostream &os, const Quantity<UnitTag, Rep> &q) {
+  // Unary + prints 8-bit integer representations as numbers, not characters
+  os << +q.value() << " " << UnitTraits<UnitTag>::symbol();
   return os;
 }
 
+// ============================================================================
+// Batch Conversion
+// ============================================================================
+// Converts contiguous buffers of raw values between units. The unit pair is
+// validated and its factor resolved once per call (at compile time for
+// generated units, through the runtime factor cache otherwise); the buffer is
+// then processed by the runtime-dispatched SIMD kernels of qtty/simd/.
+//
+// `in` and `out` may be the same buffer; partially overlapping ranges are
+// not supported.
+
+namespace detail {
+
+// Resolve `from` → `to` once, then convert the whole buffer in one SIMD pass
+template <typename Rep>
+QttyStatus convert_batch_ffi(UnitId from, UnitId to, const Rep *in, Rep *out,
+                             std::size_t count) noexcept {
+  double factor = 0.0;
+  bool linear = false;
+  const QttyStatus status = resolve_conversion_factor(from, to, factor, linear);
+  if (status != QTTY_STATUS_OK) {
+    return status;
+  }
+  if (linear) {
+    simd::scale(in, out, count, static_cast<Rep>(factor));
+    return QTTY_STATUS_OK;
+  }
+
+  // qtty-ffi conversions are affine: f(v) = v * (f(1) - f(0)) + f(0), so one
+  // more query replaces a round trip per element (as in Converter::try_make)
+  const Result<double> zero = try_convert_value(0.0, from, to);
+  if (!zero) {
+    return zero.status();
+  }
+  simd::affine(in, out, count, static_cast<Rep>(factor - *zero), static_cast<Rep>(*zero));
+  return QTTY_STATUS_OK;
+}
+
+// convert_batch_runtime() reporting failures through the returned status
+template <typename Rep>
+QttyStatus try_convert_batch_runtime(UnitId from, UnitId to, const Rep *in, Rep *out,
+                                     std::size_t count) noexcept {
+  if (count == 0 || (from == to && in == out)) {
+    return QTTY_STATUS_OK;
+  }
+  return convert_batch_ffi(from, to, in, out, count);
+}
+
+template <typename Rep>
+void convert_batch_runtime(UnitId from, UnitId to, const Rep *in, Rep *out, std::size_t count) {
+  check_status(convert_batch_ffi(from, to, in, out, count), "Converting units");
+}
+
+// Typed batch conversions take only pairs that pass dimensions_compatible()
+template <typename FromType, typename ToType>
+using enable_batch_conversion_t =
+    std::enable_if_t<dimensions_compatible<typename ExtractTag<FromType>::type,
+                                           typename ExtractTag<ToType>::type>(),
+                     int>;
+
+template <typename FromType, typename ToType, typename Rep>
+void convert_batch_typed(const Rep *in, Rep *out, std::size_t count) {
+  using FromTag = typename ExtractTag<FromType>::type;
+  using ToTag = typename ExtractTag<ToType>::type;
+  static_assert(dimensions_compatible<FromTag, ToTag>(),
+                "Cannot convert between units of different dimensions");
+
+  if constexpr (has_static_conversion<FromTag, ToTag>()) {
+    simd::scale(in, out, count, static_cast<Rep>(conversion_factor_v<FromTag, ToTag>));
+  } else if constexpr (is_compound_v<FromTag>) {
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<Rep>(Quantity<FromTag>(in[i]).template to<ToTag>().value());
+    }
+  } else {
+    convert_batch_runtime(UnitTraits<FromTag>::unit_id(), UnitTraits<ToTag>::unit_id(), in, out,
+                          count);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Convert @p count values from runtime unit @p from to @p to.
+ * @throws QttyException and derived exception types on FFI failure.
+ */
+inline void convert_batch(UnitId from, UnitId to, const double *in, double *out,
+                          std::size_t count) {
+  detail::convert_batch_runtime(from, to, in, out, count);
+}
+
+/// Single-precision overload of convert_batch(); the factor is rounded to float.
+inline void convert_batch(UnitId from, UnitId to, const float *in, float *out,
+                          std::size_t count) {
+  detail::convert_batch_runtime(from, to, in, out, count);
+}
+
+/**
+ * @brief Convert @p count values in place from runtime unit @p from to @p to.
+ * @throws QttyException and derived exception types on FFI failure.
+ */
+inline void convert_batch(UnitId from, UnitId to, double *data, std::size_t count) {
+  convert_batch(from, to, data, data, count);
+}
+
+/// Single-precision, in-place overload of convert_batch().
+inline void convert_batch(UnitId from, UnitId to, float *data, std::size_t count) {
+  convert_batch(from, to, data, data, count);
+}
+
+/**
+ * @brief Convert @p count raw values from `FromType` to `ToType`.
+ *
+ * Accepts tags or Quantity types, like Quantity::to<>(). For generated units
+ * the factor is a compile-time constant and no FFI call is made; pairs of
+ * different dimensions do not compile.
+ */
+template <typename FromType, typename ToType,
+          detail::enable_batch_conversion_t<FromType, ToType> = 0>
+void convert_batch(const double *in, double *out, std::size_t count) {
+  detail::convert_batch_typed<FromType, ToType>(in, out, count);
+}
+
+/// Single-precision overload of convert_batch(); the factor is rounded to float.
+template <typename FromType, typename ToType,
+          detail::enable_batch_conversion_t<FromType, ToType> = 0>
+void convert_batch(const float *in, float *out, std::size_t count) {
+  detail::convert_batch_typed<FromType, ToType>(in, out, count);
+}
+
+/**
+ * @brief Convert @p count raw values in place from `FromType` to `ToType`.
+ */
+template <typename FromType, typename ToType,
+          detail::enable_batch_conversion_t<FromType, ToType> = 0>
+void convert_batch(double *data, std::size_t count) {
+  convert_batch<FromType, ToType>(data, data, count);
+}
+
+/// Single-precision, in-place overload of convert_batch().
+template <typename FromType, typename ToType,
+          detail::enable_batch_conversion_t<FromType, ToType> = 0>
+void convert_batch(float *data, std::size_t count) {
+  convert_batch<FromType, ToType>(data, data, count);
+}
+
+#if __cplusplus >= 202002L
+// std::span overloads of the batch conversion entry points (C++20).
+
+/**
+ * @brief Convert @p in into @p out (which must be at least as large).
+ * @throws QttyException when @p out is smaller than @p in.
+ */
+template <typename FromType, typename ToType,
+          detail::enable_batch_conversion_t<FromType, ToType> = 0>
+void convert_batch(std::span<const double> in, std::span<double> out) {
+  if (out.size() < in.size()) {
+    check_status(QTTY_STATUS_BUFFER_TOO_SMALL, "convert_batch");
+  }
+  convert_batch<FromType, ToType>(in.data(), out.data(), in.size());
+}
+
+/// In-place overload of convert_batch().
+template <typename FromType, typename ToType,
+          detail::enable_batch_conversion_t<FromType, ToType> = 0>
+void convert_batch(std::span<double> data) {
+  convert_batch<FromType, ToType>(data.data(), data.size());
+}
+
+/// Runtime-unit overload of convert_batch().
+inline void convert_batch(UnitId from, UnitId to, std::span<const double> in,
+                          std::span<double> out) {
+  if (out.size() < in.size()) {
+    check_status(QTTY_STATUS_BUFFER_TOO_SMALL, "convert_batch");
+  }
+  convert_batch(from, to, in.data(), out.data(), in.size());
+}
+
+/// Runtime-unit, in-place overload of convert_batch().
+inline void convert_batch(UnitId from, UnitId to, std::span<double> data) {
+  convert_batch(from, to, data.data(), data.size());
+}
+
+#endif // __cplusplus >= 202002L
+
 } // namespace qtty
 
 // ============================================================================
 // C++20 std::formatter specialisation
 // ============================================================================
 // Allows `std::format` and `std::print` to be used with any Quantity type,
-// honouring the same format specifiers as std::formatter<double>:
+// honouring the same format specifiers as std::formatter<Rep> (i.e.
+// std::formatter<double> for the default representation):
 //
 //   std::format("{}", qty)          → "1234.56789 s"
 //   std::format("{:.2f}", qty)      → "1234.57 s"
@@ -402,21 +1705,21 @@ template <typename UnitTag> std::ostream &operator<<(std::ostream &os, const Qua
 
 namespace std {
 
-template <typename UnitTag> struct formatter<qtty::Quantity<UnitTag>> {
+template <typename UnitTag, typename Rep> struct formatter<qtty::Quantity<UnitTag, Rep>> {
 private:
-  std::formatter<double> double_fmt_;
+  std::formatter<Rep> value_fmt_;
 
 public:
   /// Parse the format specification (e.g. ".2f", "e", ".4e").
   template <typename ParseContext> constexpr auto parse(ParseContext &ctx) {
-    return double_fmt_.parse(ctx);
+    return value_fmt_.parse(ctx);
   }
 
   /// Format the quantity: apply the parsed spec to the value, then append the
   /// unit symbol.
   template <typename FormatContext>
-  auto format(const qtty::Quantity<UnitTag> &qty, FormatContext &ctx) const {
-    auto out = double_fmt_.format(qty.value(), ctx);
+  auto format(const qtty::Quantity<UnitTag, Rep> &qty, FormatContext &ctx) const {
+    auto out = value_fmt_.format(qty.value(), ctx);
     return std::format_to(out, " {}", qtty::UnitTraits<UnitTag>::symbol());
   }
 };
@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file parallel.hpp
+ * @brief Multi-threaded batch conversion, array expressions and reductions.
+ *
+ * Every bulk operation on spans and array expressions has an overload taking
+ * an execution policy as its first argument:
+ *
+ * @code
+ * qtty::QuantityArray<qtty::KilometerTag> km = load(); // 10^9 values
+ * qtty::convert_batch<qtty::Meter>(qtty::execution::par, km.span());
+ * qtty::Kilometer total = qtty::sum(qtty::execution::par, km.span());
+ * @endcode
+ *
+ * Work is split into chunks of a fixed number of elements, independent of
+ * the thread count, and per-chunk partial results are combined in chunk
+ * order. Results are therefore bitwise identical for every thread count and
+ * every policy.
+ */
+
+#include "array_expr.hpp"
+#include "ffi_core.hpp"
+#include "quantity_array.hpp"
+#include "quantity_span.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Define to 1 to accept `std::execution` policies as well. Off by default:
+/// with libstdc++, merely including `<execution>` needs TBB at link time
+/// whenever the TBB headers are installed. The CMake target sets it when it
+/// finds TBB.
+#ifndef QTTY_ENABLE_STD_EXECUTION
+#define QTTY_ENABLE_STD_EXECUTION 0
+#endif
+
+#if QTTY_ENABLE_STD_EXECUTION && __has_include(<execution>)
+#include <execution>
+#endif
+
+#if QTTY_ENABLE_STD_EXECUTION && defined(__cpp_lib_execution) &&                                  \
+    defined(__cpp_lib_parallel_algorithm)
+#define QTTY_HAS_STD_EXECUTION 1
+#else
+#define QTTY_HAS_STD_EXECUTION 0
+#endif
+
+namespace qtty {
+
+namespace execution {
+
+/**
+ * @brief qtty's own parallel policy: chunks run on plain `std::thread`s.
+ *
+ * Needs no parallel-algorithms backend (TBB for libstdc++). `threads` is the
+ * number of threads to use, the calling one included; 0 uses
+ * `std::thread::hardware_concurrency()`.
+ */
+struct parallel_policy {
+  unsigned threads = 0;
+};
+
+/// Parallel policy using every hardware thread.
+inline constexpr parallel_policy par{};
+
+/// Runs the same chunks as parallel_policy, in order, on the calling thread.
+struct sequenced_policy {};
+
+inline constexpr sequenced_policy seq{};
+
+} // namespace execution
+
+/**
+ * @brief True for the qtty::execution policies and, with
+ *        `QTTY_ENABLE_STD_EXECUTION`, the `std::execution` policies.
+ *
+ * Standard policies are forwarded to `std::for_each`, so they need the
+ * library's parallel backend at link time (e.g. `-ltbb` with libstdc++).
+ */
+template <typename T>
+inline constexpr bool is_execution_policy_v =
+    std::is_same_v<std::decay_t<T>, execution::parallel_policy> ||
+    std::is_same_v<std::decay_t<T>, execution::sequenced_policy>
+#if QTTY_HAS_STD_EXECUTION
+    || std::is_execution_policy_v<std::decay_t<T>>
+#endif
+    ;
+
+namespace detail {
+
+/// Elements per parallel task. Fixed, so chunk boundaries (and therefore
+/// the order in which partial results are combined) never depend on the
+/// number of threads.
+inline constexpr std::size_t kParallelChunk = std::size_t(1) << 16;
+
+template <typename Policy>
+using enable_execution_policy_t = std::enable_if_t<is_execution_policy_v<Policy>, int>;
+
+constexpr std::size_t chunk_count(std::size_t count) noexcept {
+  return (count + kParallelChunk - 1) / kParallelChunk;
+}
+
+// Calls fn(begin, end, chunk) for chunks [first, chunks) of `count` elements
+template <typename Fn>
+void run_chunks(const execution::parallel_policy &policy, std::size_t count, std::size_t first,
+                const Fn &fn) {
+  const std::size_t chunks = chunk_count(count);
+  if (first >= chunks) {
+    return;
+  }
+  const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+  const std::size_t threads =
+      std::min<std::size_t>(policy.threads == 0 ? hardware : policy.threads, chunks - first);
+
+  std::atomic<std::size_t> next{first};
+  auto worker = [&] {
+    for (std::size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks;
+         c = next.fetch_add(1, std::memory_order_relaxed)) {
+      fn(c * kParallelChunk, std::min(count, (c + 1) * kParallelChunk), c);
+    }
+  };
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (std::size_t t = 1; t < threads; ++t) {
+    pool.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : pool) {
+    thread.join();
+  }
+}
+
+template <typename Fn>
+void run_chunks(execution::sequenced_policy, std::size_t count, std::size_t first, const Fn &fn) {
+  for (std::size_t c = first; c < chunk_count(count); ++c) {
+    fn(c * kParallelChunk, std::min(count, (c + 1) * kParallelChunk), c);
+  }
+}
+
+#if QTTY_HAS_STD_EXECUTION
+template <typename Policy, typename Fn,
+          typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>>>
+void run_chunks(Policy &&policy, std::size_t count, std::size_t first, const Fn &fn) {
+  const std::size_t chunks = chunk_count(count);
+  if (first >= chunks) {
+    return;
+  }
+  std::vector<std::size_t> ids(chunks - first);
+  std::iota(ids.begin(), ids.end(), first);
+  std::for_each(std::forward<Policy>(policy), ids.begin(), ids.end(), [&](std::size_t c) {
+    fn(c * kParallelChunk, std::min(count, (c + 1) * kParallelChunk), c);
+  });
+}
+#endif
+
+// Conversions that may throw (runtime unit pairs) convert the first chunk on
+// the calling thread: that validates the pair and caches its factor before
+// any worker starts, so workers never throw.
+template <typename FromTag, typename ToTag, typename Rep, typename Policy>
+void parallel_convert(Policy &&policy, const Rep *in, Rep *out, std::size_t count) {
+  constexpr bool may_throw =
+      !std::is_same_v<FromTag, ToTag> && !has_static_conversion<FromTag, ToTag>();
+  std::size_t first = 0;
+  if constexpr (may_throw) {
+    convert_values<FromTag, ToTag>(in, out, std::min(count, kParallelChunk));
+    first = 1;
+  }
+  run_chunks(std::forward<Policy>(policy), count, first,
+             [&](std::size_t begin, std::size_t end, std::size_t) {
+               convert_values<FromTag, ToTag>(in + begin, out + begin, end - begin);
+             });
+}
+
+// Reduces each chunk with `reduce(begin, end)` and folds the partials in
+// chunk order with `combine`
+template <typename T, typename Policy, typename Reduce, typename Combine>
+T parallel_reduce(Policy &&policy, std::size_t count, T init, Reduce reduce, Combine combine) {
+  std::vector<T> partials(chunk_count(count), init);
+  run_chunks(std::forward<Policy>(policy), count, 0,
+             [&](std::size_t begin, std::size_t end, std::size_t c) {
+               partials[c] = reduce(begin, end);
+             });
+  if (partials.empty()) {
+    return init;
+  }
+  T result = partials[0];
+  for (std::size_t c = 1; c < partials.size(); ++c) {
+    result = combine(result, partials[c]);
+  }
+  return result;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Batch Conversion
+// ============================================================================
+
+/**
+ * @brief Convert @p in into @p out (which must have the same size) in
+ *        parallel.
+ * @throws QttyException when the sizes differ, or on FFI failure for unit
+ *         pairs without a compile-time factor.
+ */
+template <typename Policy, typename FromTag, typename InRep, typename ToTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0>
+void convert_batch(Policy &&policy, QuantitySpan<FromTag, InRep> in, QuantitySpan<ToTag, Rep> out) {
+  static_assert(std::is_same_v<std::remove_const_t<InRep>, Rep>,
+                "Views must share one non-const output representation");
+  detail::check_same_size(in.size(), out.size(), "convert_batch");
+  detail::parallel_convert<FromTag, ToTag>(std::forward<Policy>(policy), in.raw_data(),
+                                           out.raw_data(), in.size());
+}
+
+/**
+ * @brief Convert the values of @p data to `ToType` in place, in parallel.
+ * @return A view of the same memory typed in the target unit.
+ */
+template <typename ToType, typename Policy, typename FromTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0,
+          typename = std::enable_if_t<!std::is_const_v<Rep>>>
+QuantitySpan<typename ExtractTag<ToType>::type, Rep>
+convert_batch(Policy &&policy, QuantitySpan<FromTag, Rep> data) {
+  using ToTag = typename ExtractTag<ToType>::type;
+  detail::parallel_convert<FromTag, ToTag>(std::forward<Policy>(policy), data.raw_data(),
+                                           data.raw_data(), data.size());
+  return {data.raw_data(), data.size()};
+}
+
+// ============================================================================
+// Array Expressions
+// ============================================================================
+
+/**
+ * @brief Evaluate @p expr into @p out in parallel, converting to the unit of
+ *        @p out.
+ * @throws QttyException when the sizes differ.
+ */
+template <typename Policy, typename Op, typename Lhs, typename Rhs, typename UnitTag,
+          typename Rep, detail::enable_execution_policy_t<Policy> = 0,
+          typename = std::enable_if_t<!std::is_const_v<Rep>>>
+void evaluate(Policy &&policy, const ArrayExpr<Op, Lhs, Rhs> &expr,
+              QuantitySpan<UnitTag, Rep> out) {
+  detail::check_same_size(expr.size(), out.size(), "evaluate");
+  Rep *values = out.raw_data();
+  detail::run_chunks(std::forward<Policy>(policy), expr.size(), 0,
+                     [&](std::size_t begin, std::size_t end, std::size_t) {
+                       detail::evaluate_range<UnitTag>(values, expr, detail::AssignValue{},
+                                                       begin, end);
+                     });
+}
+
+/// Evaluate @p expr in parallel into a new array of its own unit and
+/// representation.
+template <typename Policy, typename Op, typename Lhs, typename Rhs,
+          detail::enable_execution_policy_t<Policy> = 0>
+QuantityArray<typename ArrayExpr<Op, Lhs, Rhs>::value_type::unit_tag,
+              typename ArrayExpr<Op, Lhs, Rhs>::value_type::rep>
+evaluate(Policy &&policy, const ArrayExpr<Op, Lhs, Rhs> &expr) {
+  using Value = typename ArrayExpr<Op, Lhs, Rhs>::value_type;
+  QuantityArray<typename Value::unit_tag, typename Value::rep> result(expr.size());
+  evaluate(std::forward<Policy>(policy), expr, result.span());
+  return result;
+}
+
+// ============================================================================
+// Reductions
+// ============================================================================
+// Same contracts as the sequential reductions, except that min() and max()
+// of an empty view throw QttyException instead of reading past it. Each
+// chunk is summed in order, then the chunk sums are added in chunk order: the result does not
+// depend on the thread count, but may differ in the last bits from the
+// sequential sum(), which adds every element in one running total.
+
+template <typename Policy, typename UnitTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0>
+Quantity<UnitTag, std::remove_const_t<Rep>> sum(Policy &&policy,
+                                                QuantitySpan<UnitTag, Rep> values) {
+  using R = std::remove_const_t<Rep>;
+  using Acc = detail::accumulate_t<R>;
+  const Rep *raw = values.raw_data();
+  const Acc total = detail::parallel_reduce(
+      std::forward<Policy>(policy), values.size(), Acc(0),
+      [raw](std::size_t begin, std::size_t end) {
+        Acc partial = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+          partial += raw[i];
+        }
+        return partial;
+      },
+      [](Acc a, Acc b) { return a + b; });
+  return Quantity<UnitTag, R>(detail::to_rep<R>(total));
+}
+
+template <typename Policy, typename UnitTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0>
+Quantity<UnitTag, std::remove_const_t<Rep>> min(Policy &&policy,
+                                                QuantitySpan<UnitTag, Rep> values) {
+  using R = std::remove_const_t<Rep>;
+  if (values.empty()) {
+    check_status(QTTY_STATUS_BUFFER_TOO_SMALL, "qtty::min of an empty span");
+  }
+  const Rep *raw = values.raw_data();
+  return Quantity<UnitTag, R>(detail::parallel_reduce(
+      std::forward<Policy>(policy), values.size(), R(raw[0]),
+      [raw](std::size_t begin, std::size_t end) {
+        R best = raw[begin];
+        for (std::size_t i = begin + 1; i < end; ++i) {
+          best = raw[i] < best ? raw[i] : best;
+        }
+        return best;
+      },
+      [](R a, R b) { return b < a ? b : a; }));
+}
+
+template <typename Policy, typename UnitTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0>
+Quantity<UnitTag, std::remove_const_t<Rep>> max(Policy &&policy,
+                                                QuantitySpan<UnitTag, Rep> values) {
+  using R = std::remove_const_t<Rep>;
+  if (values.empty()) {
+    check_status(QTTY_STATUS_BUFFER_TOO_SMALL, "qtty::max of an empty span");
+  }
+  const Rep *raw = values.raw_data();
+  return Quantity<UnitTag, R>(detail::parallel_reduce(
+      std::forward<Policy>(policy), values.size(), R(raw[0]),
+      [raw](std::size_t begin, std::size_t end) {
+        R best = raw[begin];
+        for (std::size_t i = begin + 1; i < end; ++i) {
+          best = best < raw[i] ? raw[i] : best;
+        }
+        return best;
+      },
+      [](R a, R b) { return a < b ? b : a; }));
+}
+
+} // namespace qtty
@@ -0,0 +1,670 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file qcol.hpp
+ * @brief Memory-mapped columnar quantity files (`.qcol`).
+ *
+ * A `.qcol` file stores named columns of raw values, each tagged with its
+ * unit and representation. qcol::File maps the file read-only and hands out
+ * QuantitySpan views straight into the mapping, so opening a multi-gigabyte
+ * table costs a header check and pages are read only when touched:
+ *
+ * @code
+ * qtty::qcol::Writer writer;
+ * writer.add("range", ranges.span());        // QuantityArray<KilometerTag>
+ * writer.add("epoch", epochs.span());        // QuantityArray<SecondTag>
+ * writer.write("ephemeris.qcol");
+ *
+ * qtty::qcol::File file = qtty::qcol::File::open("ephemeris.qcol");
+ * auto range = file.view<qtty::Kilometer>("range");   // zero-copy
+ * auto metres = file.load<qtty::Meter>("range");      // one bulk conversion
+ * @endcode
+ *
+ * Layout (all integers little-endian; values in the binary.hpp encoding):
+ *
+ * | Offset | Size | Field |
+ * |--------|------|-------|
+ * | 0      | 4    | Magic `QCOL` |
+ * | 4      | 1    | Format version (kFormatVersion, currently 2) |
+ * | 5      | 3    | Reserved, zero |
+ * | 8      | 4    | Column count |
+ * | 12     | 4    | Reserved, zero |
+ * | 16     | 8    | Checksum of the column directory |
+ * | 24     | 8    | Reserved, zero |
+ * | 32     | 80×n | Column directory, one entry per column |
+ *
+ * Directory entry:
+ *
+ * | Offset | Size | Field |
+ * |--------|------|-------|
+ * | 0      | 32   | Name, NUL-padded (at most kMaxNameLength characters) |
+ * | 32     | 8    | Offset of the values from the start of the file |
+ * | 40     | 8    | Number of values |
+ * | 48     | 8    | Checksum of the values |
+ * | 56     | 4    | Unit id (numerator of a CompoundTag) |
+ * | 60     | 4    | Denominator unit id of a CompoundTag, else binary::kNoUnit |
+ * | 64     | 1    | Representation (RepType) |
+ * | 65     | 1    | log2 of the alignment of the values |
+ * | 66     | 14   | Reserved, zero |
+ *
+ * Checksums combine the values, read as little-endian words, with 64-bit
+ * FNV-1a after mixing each word with the MurmurHash3 finalizer, so every bit
+ * of a value reaches every bit of the hash.
+ * Opening checks the header and directory; File::verify() also checksums the
+ * values, which reads every page.
+ */
+
+#include "binary.hpp"
+#include "ffi_core.hpp"
+#include "quantity_array.hpp"
+#include "quantity_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define QTTY_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define QTTY_HAS_MMAP 0
+#endif
+
+namespace qtty {
+
+namespace qcol {
+
+/// Version written into every file; files of other versions are rejected on
+/// open. Version 2 changed the checksum.
+inline constexpr std::uint8_t kFormatVersion = 2;
+/// Longest column name, in bytes.
+inline constexpr std::size_t kMaxNameLength = 31;
+/// Alignment of every column's values within the file.
+inline constexpr std::size_t kColumnAlignment = 64;
+
+/// Representation of a column's values.
+enum class RepType : std::uint8_t { F64 = 1, F32 = 2, I32 = 3, I64 = 4 };
+
+/**
+ * @brief Directory entry of one column.
+ */
+struct ColumnInfo {
+  std::string_view name;   ///< Column name (points into the mapping)
+  UnitId unit{};           ///< Unit, or numerator of a compound unit
+  UnitId denominator{};    ///< Denominator of a compound unit, or binary::kNoUnit
+  RepType rep = RepType::F64;
+  std::size_t alignment = 0;
+  std::uint64_t length = 0;   ///< Number of values
+  std::uint64_t offset = 0;   ///< Offset of the values from the start of the file
+  std::uint64_t checksum = 0; ///< Checksum of the values
+};
+
+} // namespace qcol
+
+namespace detail {
+
+inline constexpr std::size_t kQcolHeaderSize = 32;
+inline constexpr std::size_t kQcolEntrySize = 80;
+inline constexpr std::uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ULL;
+inline constexpr std::uint64_t kFnvPrime = 0x100000001b3ULL;
+
+template <typename Rep> constexpr qcol::RepType qcol_rep_type() noexcept {
+  if constexpr (std::is_same_v<Rep, double>) {
+    return qcol::RepType::F64;
+  } else if constexpr (std::is_same_v<Rep, float>) {
+    return qcol::RepType::F32;
+  } else if constexpr (std::is_same_v<Rep, std::int32_t>) {
+    return qcol::RepType::I32;
+  } else {
+    static_assert(std::is_same_v<Rep, std::int64_t>,
+                  "qcol columns hold double, float, int32_t or int64_t values");
+    return qcol::RepType::I64;
+  }
+}
+
+inline std::size_t qcol_rep_size(qcol::RepType rep) noexcept {
+  return rep == qcol::RepType::F32 || rep == qcol::RepType::I32 ? 4 : 8;
+}
+
+// MurmurHash3's 64-bit finalizer. A whole word XORed straight into FNV-1a
+// would only carry its high bits upward through the multiply (two flipped
+// sign bits would cancel); mixed first, every input bit reaches every bit.
+constexpr std::uint64_t qcol_mix(std::uint64_t word) noexcept {
+  word ^= word >> 33;
+  word *= 0xff51afd7ed558ccdULL;
+  word ^= word >> 33;
+  word *= 0xc4ceb9fe1a85ec53ULL;
+  return word ^ (word >> 33);
+}
+
+// FNV-1a over the mixed @p count host-order words of @p Width bytes, each
+// hashed as the little-endian value it is stored as
+template <std::size_t Width>
+std::uint64_t qcol_checksum_host(const void *data, std::size_t count) noexcept {
+  using Word = std::conditional_t<Width == 8, std::uint64_t, std::uint32_t>;
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  std::uint64_t hash = kFnvOffsetBasis;
+  for (std::size_t i = 0; i < count; ++i) {
+    Word word;
+    std::memcpy(&word, bytes + i * Width, Width);
+    hash = (hash ^ qcol_mix(word)) * kFnvPrime;
+  }
+  return hash;
+}
+
+// The same checksum over @p count little-endian words as stored in a file
+template <std::size_t Width>
+std::uint64_t qcol_checksum_stored(const std::byte *data, std::size_t count) noexcept {
+  using Word = std::conditional_t<Width == 8, std::uint64_t, std::uint32_t>;
+  if constexpr (!kBigEndianHost) {
+    return qcol_checksum_host<Width>(data, count);
+  }
+  std::uint64_t hash = kFnvOffsetBasis;
+  for (std::size_t i = 0; i < count; ++i) {
+    hash = (hash ^ qcol_mix(load_little_endian<Word>(data + i * Width))) * kFnvPrime;
+  }
+  return hash;
+}
+
+// Read-only view of a whole file: mmap() where available, otherwise a copy
+// in 64-byte aligned memory
+class FileMapping {
+public:
+  FileMapping() noexcept = default;
+  FileMapping(const FileMapping &) = delete;
+  FileMapping &operator=(const FileMapping &) = delete;
+  FileMapping(FileMapping &&other) noexcept
+      : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+  FileMapping &operator=(FileMapping &&other) noexcept {
+    if (this != &other) {
+      release();
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+  }
+  ~FileMapping() { release(); }
+
+  QttyStatus map(const char *path) noexcept {
+    release();
+#if QTTY_HAS_MMAP
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return kStatusIoError;
+    }
+    struct stat info {};
+    void *data = MAP_FAILED;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+      data = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd,
+                    0);
+    }
+    ::close(fd);
+    if (data == MAP_FAILED) {
+      return kStatusIoError;
+    }
+    m_data = static_cast<const std::byte *>(data);
+    m_size = static_cast<std::size_t>(info.st_size);
+#else
+    std::FILE *file = std::fopen(path, "rb");
+    if (!file) {
+      return kStatusIoError;
+    }
+    long size = -1;
+    if (std::fseek(file, 0, SEEK_END) == 0) {
+      size = std::ftell(file);
+    }
+    void *data = size > 0 ? ::operator new(static_cast<std::size_t>(size),
+                                           std::align_val_t{kQcolAlignment}, std::nothrow)
+                          : nullptr;
+    const bool read = data && std::fseek(file, 0, SEEK_SET) == 0 &&
+                      std::fread(data, 1, static_cast<std::size_t>(size), file) ==
+                          static_cast<std::size_t>(size);
+    std::fclose(file);
+    if (!read) {
+      ::operator delete(data, std::align_val_t{kQcolAlignment}, std::nothrow);
+      return kStatusIoError;
+    }
+    m_data = static_cast<const std::byte *>(data);
+    m_size = static_cast<std::size_t>(size);
+#endif
+    return QTTY_STATUS_OK;
+  }
+
+  const std::byte *data() const noexcept { return m_data; }
+  std::size_t size() const noexcept { return m_size; }
+
+private:
+#if !QTTY_HAS_MMAP
+  static constexpr std::size_t kQcolAlignment = 64;
+#endif
+
+  void release() noexcept {
+    if (!m_data) {
+      return;
+    }
+#if QTTY_HAS_MMAP
+    ::munmap(const_cast<std::byte *>(m_data), m_size);
+#else
+    ::operator delete(const_cast<std::byte *>(m_data), std::align_val_t{kQcolAlignment},
+                      std::nothrow);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  const std::byte *m_data = nullptr;
+  std::size_t m_size = 0;
+};
+
+// Column values as `Rep`, widened or rounded from another stored representation
+template <typename Rep>
+void read_qcol_values(const qcol::ColumnInfo &column, const std::byte *values, Rep *out) noexcept {
+  const auto count = static_cast<std::size_t>(column.length);
+  if (column.rep == qcol_rep_type<Rep>()) {
+    copy_little_endian<Rep>(out, values, count);
+    return;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    switch (column.rep) {
+    case qcol::RepType::F64:
+      out[i] = static_cast<Rep>(load_scalar<double>(values + 8 * i));
+      break;
+    case qcol::RepType::F32:
+      out[i] = static_cast<Rep>(load_scalar<float>(values + 4 * i));
+      break;
+    case qcol::RepType::I32:
+      out[i] = static_cast<Rep>(
+          static_cast<std::int32_t>(load_little_endian<std::uint32_t>(values + 4 * i)));
+      break;
+    case qcol::RepType::I64:
+      out[i] = static_cast<Rep>(
+          static_cast<std::int64_t>(load_little_endian<std::uint64_t>(values + 8 * i)));
+      break;
+    }
+  }
+}
+
+} // namespace detail
+
+namespace qcol {
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+/**
+ * @brief Collects columns and writes them as one `.qcol` file.
+ *
+ * add() only records where the values are; they are read by write(), so the
+ * buffers must outlive that call.
+ */
+class Writer {
+public:
+  /**
+   * @brief Add a column of @p values under @p name.
+   * @throws QttyException when @p name is longer than kMaxNameLength.
+   */
+  template <typename UnitTag, typename Rep>
+  void add(std::string_view name, QuantitySpan<UnitTag, Rep> values) {
+    using R = std::remove_const_t<Rep>;
+    if (name.size() > kMaxNameLength) {
+      check_status(QTTY_STATUS_BUFFER_TOO_SMALL, "qcol::Writer::add");
+    }
+    m_columns.push_back({std::string(name), detail::wire_unit<UnitTag>(),
+                         detail::wire_denominator<UnitTag>(), detail::qcol_rep_type<R>(),
+                         values.raw_data(), values.size()});
+  }
+
+  std::size_t size() const noexcept { return m_columns.size(); }
+
+  /**
+   * @brief Write the file at @p path, replacing it, without throwing.
+   * @return `kStatusIoError` when the file cannot be created or written.
+   */
+  QttyStatus try_write(const char *path) const noexcept {
+    std::FILE *file = std::fopen(path, "wb");
+    if (!file) {
+      return kStatusIoError;
+    }
+    const bool written = write_to(file);
+    const bool closed = std::fclose(file) == 0;
+    return written && closed ? QTTY_STATUS_OK : kStatusIoError;
+  }
+
+  /**
+   * @brief Write the file at @p path, replacing it.
+   * @throws QttyException when the file cannot be created or written.
+   */
+  void write(const char *path) const { check_status(try_write(path), "Writing qcol file"); }
+
+  void write(const std::string &path) const { write(path.c_str()); }
+
+private:
+  struct Column {
+    std::string name;
+    UnitId unit;
+    UnitId denominator;
+    RepType rep;
+    const void *values;
+    std::size_t length;
+  };
+
+  static constexpr std::uint8_t kLog2Alignment = 6;
+  static_assert(kColumnAlignment == std::size_t(1) << kLog2Alignment);
+
+  static std::uint64_t align_up(std::uint64_t offset) noexcept {
+    return (offset + kColumnAlignment - 1) / kColumnAlignment * kColumnAlignment;
+  }
+
+  static std::uint64_t checksum(const Column &column) noexcept {
+    return detail::qcol_rep_size(column.rep) == 8
+               ? detail::qcol_checksum_host<8>(column.values, column.length)
+               : detail::qcol_checksum_host<4>(column.values, column.length);
+  }
+
+  static bool write_values(std::FILE *file, const Column &column) noexcept {
+    const std::size_t width = detail::qcol_rep_size(column.rep);
+    if constexpr (!detail::kBigEndianHost) {
+      return std::fwrite(column.values, width, column.length, file) == column.length;
+    }
+    // Byte-swapped through a staging buffer
+    constexpr std::size_t kChunk = 8192;
+    unsigned char staging[kChunk * 8];
+    const auto *values = static_cast<const unsigned char *>(column.values);
+    for (std::size_t first = 0; first < column.length; first += kChunk) {
+      const std::size_t count = std::min(kChunk, column.length - first);
+      if (width == 8) {
+        detail::byteswap_copy<std::uint64_t>(staging, values + first * 8, count);
+      } else {
+        detail::byteswap_copy<std::uint32_t>(staging, values + first * 4, count);
+      }
+      if (std::fwrite(staging, width, count, file) != count) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool write_to(std::FILE *file) const noexcept {
+    const std::size_t directory_size = m_columns.size() * detail::kQcolEntrySize;
+    const std::unique_ptr<std::byte[]> directory(new (std::nothrow) std::byte[directory_size]());
+    if (!directory) {
+      return false;
+    }
+
+    std::uint64_t offset = align_up(detail::kQcolHeaderSize + directory_size);
+    for (std::size_t c = 0; c < m_columns.size(); ++c) {
+      const Column &column = m_columns[c];
+      std::byte *entry = directory.get() + c * detail::kQcolEntrySize;
+      std::memcpy(entry, column.name.data(), column.name.size());
+      detail::store_little_endian<std::uint64_t>(entry + 32, offset);
+      detail::store_little_endian<std::uint64_t>(entry + 40, column.length);
+      detail::store_little_endian<std::uint64_t>(entry + 48, checksum(column));
+      detail::store_little_endian(entry + 56, static_cast<std::uint32_t>(column.unit));
+      detail::store_little_endian(entry + 60, static_cast<std::uint32_t>(column.denominator));
+      entry[64] = std::byte{static_cast<std::uint8_t>(column.rep)};
+      entry[65] = std::byte{kLog2Alignment};
+      offset = align_up(offset + column.length * detail::qcol_rep_size(column.rep));
+    }
+
+    std::byte header[detail::kQcolHeaderSize] = {};
+    std::memcpy(header, "QCOL", 4);
+    header[4] = std::byte{kFormatVersion};
+    detail::store_little_endian(header + 8, static_cast<std::uint32_t>(m_columns.size()));
+    detail::store_little_endian<std::uint64_t>(
+        header + 16, detail::qcol_checksum_stored<8>(directory.get(), directory_size / 8));
+
+    static const std::byte padding[kColumnAlignment] = {};
+    std::uint64_t position = detail::kQcolHeaderSize + directory_size;
+    bool ok = std::fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+              std::fwrite(directory.get(), 1, directory_size, file) == directory_size;
+    for (const Column &column : m_columns) {
+      const auto gap = static_cast<std::size_t>(align_up(position) - position);
+      ok = ok && std::fwrite(padding, 1, gap, file) == gap && write_values(file, column);
+      position += gap + column.length * detail::qcol_rep_size(column.rep);
+    }
+    return ok;
+  }
+
+  std::vector<Column> m_columns;
+};
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+/**
+ * @brief A read-only, memory-mapped `.qcol` file.
+ *
+ * Views returned by view() point into the mapping and stay valid while the
+ * File (or the File it is moved into) is alive.
+ */
+class File {
+public:
+  File() noexcept = default;
+
+  /**
+   * @brief Map the file at @p path and check its header and directory,
+   *        without throwing.
+   * @return The file, `kStatusIoError` when it cannot be read, or
+   *         `kStatusMalformedInput` when it is not a valid `.qcol` file.
+   */
+  static Result<File> try_open(const char *path) noexcept {
+    File file;
+    QttyStatus status = file.m_mapping.map(path);
+    if (status == QTTY_STATUS_OK) {
+      status = file.validate();
+    }
+    if (status != QTTY_STATUS_OK) {
+      return Result<File>::from_status(status);
+    }
+    return file;
+  }
+
+  /**
+   * @brief Map the file at @p path and check its header and directory.
+   * @throws QttyException when it cannot be read or is not a `.qcol` file.
+   */
+  static File open(const char *path) {
+    Result<File> file = try_open(path);
+    check_status(file.status(), "Opening qcol file");
+    return std::move(*file);
+  }
+
+  static File open(const std::string &path) { return open(path.c_str()); }
+
+  /// Number of columns.
+  std::size_t size() const noexcept { return m_columns; }
+
+  /// Directory entry of column @p index (< size()).
+  ColumnInfo column(std::size_t index) const noexcept {
+    const std::byte *entry =
+        m_mapping.data() + detail::kQcolHeaderSize + index * detail::kQcolEntrySize;
+    ColumnInfo info;
+    const auto *name = reinterpret_cast<const char *>(entry);
+    const auto *nul = static_cast<const char *>(std::memchr(name, 0, kMaxNameLength + 1));
+    info.name = std::string_view(name, nul ? static_cast<std::size_t>(nul - name) : 0);
+    info.offset = detail::load_little_endian<std::uint64_t>(entry + 32);
+    info.length = detail::load_little_endian<std::uint64_t>(entry + 40);
+    info.checksum = detail::load_little_endian<std::uint64_t>(entry + 48);
+    info.unit = static_cast<UnitId>(detail::load_little_endian<std::uint32_t>(entry + 56));
+    info.denominator = static_cast<UnitId>(detail::load_little_endian<std::uint32_t>(entry + 60));
+    info.rep = static_cast<RepType>(entry[64]);
+    info.alignment = std::size_t(1) << static_cast<unsigned>(entry[65]);
+    return info;
+  }
+
+  /// Directory entry of the first column named @p name, or `kStatusNotFound`.
+  Result<ColumnInfo> try_find(std::string_view name) const noexcept {
+    for (std::size_t c = 0; c < m_columns; ++c) {
+      const ColumnInfo info = column(c);
+      if (info.name == name) {
+        return info;
+      }
+    }
+    return Result<ColumnInfo>::from_status(kStatusNotFound);
+  }
+
+  /**
+   * @brief Checksum the values of every column (reads the whole file).
+   * @return `kStatusMalformedInput` on the first mismatch.
+   */
+  QttyStatus verify() const noexcept {
+    for (std::size_t c = 0; c < m_columns; ++c) {
+      const ColumnInfo info = column(c);
+      const std::byte *values = m_mapping.data() + info.offset;
+      const auto count = static_cast<std::size_t>(info.length);
+      const std::uint64_t sum = detail::qcol_rep_size(info.rep) == 8
+                                    ? detail::qcol_checksum_stored<8>(values, count)
+                                    : detail::qcol_checksum_stored<4>(values, count);
+      if (sum != info.checksum) {
+        return kStatusMalformedInput;
+      }
+    }
+    return QTTY_STATUS_OK;
+  }
+
+  /**
+   * @brief View column @p name in place, without throwing.
+   *
+   * Succeeds when the column holds exactly `T`'s unit and representation (on
+   * a little-endian host). Another unit of the same dimension fails with
+   * `kStatusNotViewable`: load() it, or view it in its own unit and wrap it in
+   * `views::as<T>` to convert lazily. Another dimension fails with
+   * `QTTY_STATUS_INCOMPATIBLE_DIM`.
+   */
+  template <typename T>
+  Result<ConstQuantitySpan<typename ExtractTag<T>::type, typename ExtractRep<T>::type>>
+  try_view(std::string_view name) const noexcept {
+    using UnitTag = typename ExtractTag<T>::type;
+    using Rep = typename ExtractRep<T>::type;
+    using View = ConstQuantitySpan<UnitTag, Rep>;
+    const Result<ColumnInfo> info = try_find(name);
+    if (!info) {
+      return Result<View>::from_status(info.status());
+    }
+    const bool same_units = info->unit == detail::wire_unit<UnitTag>() &&
+                            info->denominator == detail::wire_denominator<UnitTag>();
+    if (!same_units) {
+      const QttyStatus status = detail::check_wire_units<UnitTag>(info->unit, info->denominator);
+      if (status != QTTY_STATUS_OK) {
+        return Result<View>::from_status(status);
+      }
+    }
+    if (detail::kBigEndianHost || !same_units || info->rep != detail::qcol_rep_type<Rep>()) {
+      return Result<View>::from_status(kStatusNotViewable);
+    }
+    return View(reinterpret_cast<const Rep *>(m_mapping.data() + info->offset),
+                static_cast<std::size_t>(info->length));
+  }
+
+  /**
+   * @brief View column @p name in place.
+   * @see try_view()
+   * @throws QttyException and derived exception types on failure.
+   */
+  template <typename T>
+  ConstQuantitySpan<typename ExtractTag<T>::type, typename ExtractRep<T>::type>
+  view(std::string_view name) const {
+    const auto result = try_view<T>(name);
+    check_status(result.status(), "Viewing qcol column");
+    return *result;
+  }
+
+  /**
+   * @brief Copy column @p name into a new QuantityArray in `T`, without
+   *        throwing on bad data.
+   *
+   * Values are copied once, then converted in place with one factor when the
+   * stored unit differs, and widened or rounded when the representation does.
+   * @tparam T Unit tag or Quantity type with a `double` or `float`
+   *           representation.
+   */
+  template <typename T> Result<quantity_array_t<T>> try_load(std::string_view name) const {
+    using Array = quantity_array_t<T>;
+    detail::check_binary_rep<typename Array::rep>();
+    const Result<ColumnInfo> info = try_find(name);
+    if (!info) {
+      return Result<Array>::from_status(info.status());
+    }
+    Array out(static_cast<std::size_t>(info->length));
+    detail::read_qcol_values(*info, m_mapping.data() + info->offset, out.data());
+    const QttyStatus status = detail::convert_from_wire<typename Array::unit_tag>(
+        info->unit, info->denominator, out.data(), out.size());
+    if (status != QTTY_STATUS_OK) {
+      return Result<Array>::from_status(status);
+    }
+    return out;
+  }
+
+  /**
+   * @brief Copy column @p name into a new QuantityArray in `T`.
+   * @see try_load()
+   * @throws QttyException and derived exception types on failure.
+   */
+  template <typename T> quantity_array_t<T> load(std::string_view name) const {
+    auto result = try_load<T>(name);
+    check_status(result.status(), "Loading qcol column");
+    return std::move(*result);
+  }
+
+private:
+  // Header, directory checksum and the bounds of every column
+  QttyStatus validate() noexcept {
+    const std::byte *data = m_mapping.data();
+    const std::size_t size = m_mapping.size();
+    if (size < detail::kQcolHeaderSize || std::memcmp(data, "QCOL", 4) != 0 ||
+        data[4] != std::byte{kFormatVersion}) {
+      return kStatusMalformedInput;
+    }
+    const std::uint32_t count = detail::load_little_endian<std::uint32_t>(data + 8);
+    if (count > (size - detail::kQcolHeaderSize) / detail::kQcolEntrySize) {
+      return kStatusMalformedInput;
+    }
+    const std::byte *directory = data + detail::kQcolHeaderSize;
+    const std::size_t words = count * detail::kQcolEntrySize / 8;
+    if (detail::qcol_checksum_stored<8>(directory, words) !=
+        detail::load_little_endian<std::uint64_t>(data + 16)) {
+      return kStatusMalformedInput;
+    }
+
+    m_columns = count;
+    for (std::size_t c = 0; c < m_columns; ++c) {
+      const std::byte *entry = directory + c * detail::kQcolEntrySize;
+      const auto rep = static_cast<std::uint8_t>(entry[64]);
+      const auto log2_alignment = static_cast<unsigned>(entry[65]);
+      if (rep < 1 || rep > 4 || log2_alignment > 12) {
+        return kStatusMalformedInput;
+      }
+      const ColumnInfo info = column(c);
+      const std::size_t width = detail::qcol_rep_size(info.rep);
+      if (info.alignment < width || info.offset % info.alignment != 0 || info.offset > size ||
+          info.length > (size - info.offset) / width) {
+        return kStatusMalformedInput;
+      }
+    }
+    return QTTY_STATUS_OK;
+  }
+
+  detail::FileMapping m_mapping;
+  std::size_t m_columns = 0;
+};
+
+} // namespace qcol
+
+} // namespace qtty
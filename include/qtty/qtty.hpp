@@ -15,7 +15,18 @@
  * - Support for the full qtty-ffi linear unit catalog, including pressure,
  *   solid angle, temperature, radiometry, photometric SI units, frequency,
  *   chemistry, electrical, and density families
- * - Compound quotient units such as velocity through `CompoundTag`
+ * - Quantity products, quotients and powers (`ProductTag`, `CompoundTag`,
+ *   `PowerTag`) with compile-time dimensional analysis
+ * - `QuantityArray`, an aligned contiguous container with bulk conversion,
+ *   arithmetic and reductions, and `QuantitySpan` views over external buffers
+ * - Lazy unit-conversion views (`views::as<Target>`) that defer scaling to
+ *   the consuming reduction or copy
+ * - Execution-policy overloads (`qtty::execution::par`) of batch conversion,
+ *   array expressions and reductions, deterministic for any thread count
+ * - Compensated, reproducible reductions (`qtty::reduce::sum`, `mean`, `dot`,
+ *   `norm`) with dimensionally typed results
+ * - A compact little-endian binary encoding of values and arrays
+ *   (`qtty::binary`) with zero-copy views of received payloads
  *
  * Usage example:
  * @code
@@ -83,6 +94,25 @@
 // User-defined literals
 #include "literals.hpp"
 
+// Reusable conversion plans
+#include "converter.hpp"
+
+// Contiguous quantity arrays and zero-copy views with bulk operations
+#include "quantity_array.hpp"
+#include "quantity_span.hpp"
+
+// Lazy unit-conversion views
+#include "views.hpp"
+
+// Multi-threaded bulk operations
+#include "parallel.hpp"
+
+// Compensated reductions
+#include "reduce.hpp"
+
+// Binary wire format
+#include "binary.hpp"
+
 namespace qtty {
 
 /**
@@ -0,0 +1,320 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file quantity_array.hpp
+ * @brief Contiguous, aligned arrays of quantities with bulk operations.
+ *
+ * A QuantityArray stores the raw values of many quantities of one unit in a
+ * single aligned buffer (structure of arrays: the unit lives in the type, not
+ * next to every value). Bulk operations validate the unit pair and resolve
+ * its factor once, then run one tight loop or SIMD kernel over the buffer:
+ *
+ * @code
+ * qtty::QuantityArray<qtty::KilometerTag> distances = load();
+ * auto meters = std::move(distances).to<qtty::Meter>(); // in place, no FFI call
+ * qtty::Meter total = meters.sum();
+ * @endcode
+ */
+
+#include "aligned_allocator.hpp"
+#include "array_expr.hpp"
+#include "ffi_core.hpp"
+#include "quantity_span.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace qtty {
+
+namespace detail {
+
+// True when an element of type `Value` can be stored in a QuantityArray of
+// `UnitTag` / `Rep` (Implicit: without a unit or narrowing conversion)
+template <typename Value, typename UnitTag, typename Rep, bool Implicit>
+constexpr bool storable_as() {
+  if constexpr (std::is_arithmetic_v<Value>) {
+    return false;
+  } else if constexpr (Implicit) {
+    return std::is_same_v<typename Value::unit_tag, UnitTag> &&
+           is_lossless_rep_conversion_v<typename Value::rep, Rep>;
+  } else {
+    return reexpressible<typename Value::unit_tag, UnitTag>();
+  }
+}
+
+template <typename Expr, typename UnitTag, typename Rep, bool Implicit>
+using enable_storable_t = std::enable_if_t<
+    storable_as<typename Expr::value_type, UnitTag, Rep, Implicit>(), int>;
+
+} // namespace detail
+
+/**
+ * @brief Contiguous array of `Quantity<UnitTag, Rep>` values.
+ *
+ * Values are stored as raw `Rep`s in a buffer obtained from @p Allocator
+ * (64-byte aligned by default). Elements are read and written as quantities;
+ * data() exposes the raw buffer for I/O and interop, and span() (or begin()
+ * and end()) a QuantitySpan over it.
+ *
+ * Unit conversion, scalar and elementwise arithmetic, and min/max/sum reduce
+ * to one loop over the buffer; `+ - * /` build an ArrayExpr (array_expr.hpp)
+ * that is evaluated in one loop when stored. `double` and `float` conversions use the SIMD
+ * kernels of qtty/simd/ (the factor is rounded to `Rep`, as for
+ * convert_batch()); other representations scale in at least double precision
+ * and round each value once.
+ */
+template <typename UnitTag, typename Rep = double, typename Allocator = AlignedAllocator<Rep>>
+class QuantityArray {
+  static_assert(std::is_same_v<typename Allocator::value_type, Rep>,
+                "QuantityArray allocator must allocate Rep");
+
+  template <typename, typename, typename> friend class QuantityArray;
+
+public:
+  using unit_tag = UnitTag;
+  using rep = Rep;
+  using value_type = Quantity<UnitTag, Rep>;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+  // Constructors
+  QuantityArray() = default;
+  explicit QuantityArray(const Allocator &alloc) noexcept : m_values(alloc) {}
+
+  /// @p count zero-valued quantities.
+  explicit QuantityArray(size_type count, const Allocator &alloc = Allocator())
+      : m_values(count, Rep(0), alloc) {}
+
+  /// @p count copies of @p value.
+  QuantityArray(size_type count, value_type value, const Allocator &alloc = Allocator())
+      : m_values(count, value.value(), alloc) {}
+
+  QuantityArray(std::initializer_list<value_type> init, const Allocator &alloc = Allocator())
+      : m_values(alloc) {
+    m_values.reserve(init.size());
+    for (const value_type &q : init) {
+      m_values.push_back(q.value());
+    }
+  }
+
+  /// Copy @p count raw values, each expressed in `UnitTag`.
+  QuantityArray(const Rep *values, size_type count, const Allocator &alloc = Allocator())
+      : m_values(values, values + count, alloc) {}
+
+  /// Evaluate @p expr in one pass. Implicit when its elements are already
+  /// `Quantity<UnitTag, Rep>` up to a lossless representation change.
+  template <typename Op, typename Lhs, typename Rhs,
+            detail::enable_storable_t<ArrayExpr<Op, Lhs, Rhs>, UnitTag, Rep, true> = 0>
+  QuantityArray(const ArrayExpr<Op, Lhs, Rhs> &expr, const Allocator &alloc = Allocator())
+      : m_values(expr.size(), Rep(0), alloc) {
+    detail::evaluate_into<UnitTag>(data(), expr, detail::AssignValue{});
+  }
+
+  /// Evaluate @p expr in one pass, converting into `UnitTag` and `Rep`.
+  template <typename Op, typename Lhs, typename Rhs,
+            detail::enable_storable_t<ArrayExpr<Op, Lhs, Rhs>, UnitTag, Rep, false> = 0,
+            std::enable_if_t<!detail::storable_as<typename ArrayExpr<Op, Lhs, Rhs>::value_type,
+                                                  UnitTag, Rep, true>(),
+                             int> = 0>
+  explicit QuantityArray(const ArrayExpr<Op, Lhs, Rhs> &expr,
+                         const Allocator &alloc = Allocator())
+      : m_values(expr.size(), Rep(0), alloc) {
+    detail::evaluate_into<UnitTag>(data(), expr, detail::AssignValue{});
+  }
+
+  /// Replace the contents with @p expr, which may read this array.
+  template <typename Op, typename Lhs, typename Rhs,
+            detail::enable_storable_t<ArrayExpr<Op, Lhs, Rhs>, UnitTag, Rep, true> = 0>
+  QuantityArray &operator=(const ArrayExpr<Op, Lhs, Rhs> &expr) {
+    // Element i is read before it is written, so evaluating in place is safe
+    // when @p expr reads this array (it then has the same size).
+    if (expr.size() != size()) {
+      return *this = QuantityArray(expr, get_allocator());
+    }
+    detail::evaluate_into<UnitTag>(data(), expr, detail::AssignValue{});
+    return *this;
+  }
+
+  // ========================================================================
+  // Storage and Element Access
+  // ========================================================================
+
+  size_type size() const noexcept { return m_values.size(); }
+  bool empty() const noexcept { return m_values.empty(); }
+  size_type capacity() const noexcept { return m_values.capacity(); }
+  void reserve(size_type count) { m_values.reserve(count); }
+  void resize(size_type count) { m_values.resize(count, Rep(0)); }
+  void clear() noexcept { m_values.clear(); }
+  allocator_type get_allocator() const noexcept { return m_values.get_allocator(); }
+
+  /// Raw values, each expressed in `UnitTag`.
+  Rep *data() noexcept { return m_values.data(); }
+  const Rep *data() const noexcept { return m_values.data(); }
+
+  value_type operator[](size_type index) const noexcept { return value_type(m_values[index]); }
+  void set(size_type index, value_type value) noexcept { m_values[index] = value.value(); }
+  void push_back(value_type value) { m_values.push_back(value.value()); }
+
+  /// Typed view of the buffer (invalidated like the buffer itself).
+  QuantitySpan<UnitTag, Rep> span() noexcept { return {data(), size()}; }
+  ConstQuantitySpan<UnitTag, Rep> span() const noexcept { return {data(), size()}; }
+
+  value_type *begin() noexcept { return span().begin(); }
+  value_type *end() noexcept { return span().end(); }
+  const value_type *begin() const noexcept { return span().begin(); }
+  const value_type *end() const noexcept { return span().end(); }
+
+  // ========================================================================
+  // Unit Conversion
+  // ========================================================================
+  // The dimension check happens at compile time and the factor is resolved
+  // once per call (folded at compile time for generated units). Converting
+  // an rvalue array reuses its buffer.
+
+  /// Copy of this array converted to `TargetType` (a tag or Quantity type).
+  template <typename TargetType>
+  QuantityArray<typename ExtractTag<TargetType>::type, Rep, Allocator> to() const & {
+    return QuantityArray(*this).template to<TargetType>();
+  }
+
+  /// This array converted to `TargetType` in place.
+  template <typename TargetType>
+  QuantityArray<typename ExtractTag<TargetType>::type, Rep, Allocator> to() && {
+    using TargetTag = typename ExtractTag<TargetType>::type;
+    QuantityArray<TargetTag, Rep, Allocator> result(m_values.get_allocator());
+    result.m_values = std::move(m_values);
+    if constexpr (!std::is_same_v<TargetTag, UnitTag>) {
+      detail::convert_values<UnitTag, TargetTag>(result.data(), result.data(), result.size());
+    }
+    return result;
+  }
+
+  // ========================================================================
+  // Scalar Arithmetic
+  // ========================================================================
+
+  QuantityArray &operator*=(Rep scalar) noexcept {
+    if constexpr (detail::has_simd_kernels_v<Rep>) {
+      simd::scale(data(), data(), size(), scalar);
+    } else {
+      for (Rep &v : m_values) {
+        v *= scalar;
+      }
+    }
+    return *this;
+  }
+
+  QuantityArray &operator/=(Rep scalar) noexcept {
+    for (Rep &v : m_values) {
+      v /= scalar;
+    }
+    return *this;
+  }
+
+  // ========================================================================
+  // Elementwise Arithmetic
+  // ========================================================================
+  // Both sides must have the same size (otherwise QttyException is thrown
+  // with QTTY_STATUS_BUFFER_TOO_SMALL). The right-hand side may be an array
+  // or an ArrayExpr in another unit of the same dimension with a
+  // compile-time factor; it is scaled into `UnitTag` as it is read. `a + b`
+  // and friends are ArrayExprs, see array_expr.hpp.
+
+  template <typename OtherTag, typename OtherAllocator,
+            typename = std::enable_if_t<std::is_same_v<OtherTag, UnitTag> ||
+                                        has_static_conversion<OtherTag, UnitTag>()>>
+  QuantityArray &operator+=(const QuantityArray<OtherTag, Rep, OtherAllocator> &other) {
+    detail::check_same_size(size(), other.size(), "QuantityArray::operator+=");
+    apply(other, [](Rep a, auto b) { return a + b; });
+    return *this;
+  }
+
+  template <typename OtherTag, typename OtherAllocator,
+            typename = std::enable_if_t<std::is_same_v<OtherTag, UnitTag> ||
+                                        has_static_conversion<OtherTag, UnitTag>()>>
+  QuantityArray &operator-=(const QuantityArray<OtherTag, Rep, OtherAllocator> &other) {
+    detail::check_same_size(size(), other.size(), "QuantityArray::operator-=");
+    apply(other, [](Rep a, auto b) { return a - b; });
+    return *this;
+  }
+
+  template <typename Op, typename Lhs, typename Rhs,
+            typename = std::enable_if_t<
+                detail::storable_as<typename ArrayExpr<Op, Lhs, Rhs>::value_type, UnitTag, Rep,
+                                    false>() &&
+                is_lossless_rep_conversion_v<typename ArrayExpr<Op, Lhs, Rhs>::value_type::rep,
+                                             Rep>>>
+  QuantityArray &operator+=(const ArrayExpr<Op, Lhs, Rhs> &expr) {
+    detail::check_same_size(size(), expr.size(), "QuantityArray::operator+=");
+    detail::evaluate_into<UnitTag>(data(), expr, [](auto a, auto b) { return a + b; });
+    return *this;
+  }
+
+  template <typename Op, typename Lhs, typename Rhs,
+            typename = std::enable_if_t<
+                detail::storable_as<typename ArrayExpr<Op, Lhs, Rhs>::value_type, UnitTag, Rep,
+                                    false>() &&
+                is_lossless_rep_conversion_v<typename ArrayExpr<Op, Lhs, Rhs>::value_type::rep,
+                                             Rep>>>
+  QuantityArray &operator-=(const ArrayExpr<Op, Lhs, Rhs> &expr) {
+    detail::check_same_size(size(), expr.size(), "QuantityArray::operator-=");
+    detail::evaluate_into<UnitTag>(data(), expr, [](auto a, auto b) { return a - b; });
+    return *this;
+  }
+
+  // ========================================================================
+  // Reductions
+  // ========================================================================
+  // Same as the QuantitySpan reductions: min() and max() require a
+  // non-empty array, and floating values are summed in at least double
+  // precision.
+
+  value_type sum() const noexcept { return qtty::sum(span()); }
+  value_type min() const noexcept { return qtty::min(span()); }
+  value_type max() const noexcept { return qtty::max(span()); }
+
+private:
+  // m_values[i] = op(m_values[i], other[i] expressed in UnitTag)
+  template <typename OtherTag, typename OtherAllocator, typename Op>
+  void apply(const QuantityArray<OtherTag, Rep, OtherAllocator> &other, Op op) noexcept {
+    const Rep *rhs = other.data();
+    if constexpr (std::is_same_v<OtherTag, UnitTag>) {
+      for (size_type i = 0; i < size(); ++i) {
+        m_values[i] = op(m_values[i], rhs[i]);
+      }
+    } else {
+      constexpr double factor = conversion_factor_v<OtherTag, UnitTag>;
+      for (size_type i = 0; i < size(); ++i) {
+        m_values[i] = detail::to_rep<Rep>(
+            op(static_cast<detail::compute_t<Rep>>(m_values[i]),
+               static_cast<detail::compute_t<Rep>>(rhs[i]) * factor));
+      }
+    }
+  }
+
+  std::vector<Rep, Allocator> m_values;
+};
+
+// QuantityArray of the unit and representation named by a tag or Quantity type
+template <typename T>
+using quantity_array_t = QuantityArray<typename ExtractTag<T>::type, typename ExtractRep<T>::type>;
+
+/**
+ * @brief Evaluate @p expr into a new array of its own unit and representation.
+ *
+ * `evaluate(distance / time)` is a `QuantityArray<CompoundTag<...>>`.
+ */
+template <typename Op, typename Lhs, typename Rhs>
+QuantityArray<typename ArrayExpr<Op, Lhs, Rhs>::value_type::unit_tag,
+              typename ArrayExpr<Op, Lhs, Rhs>::value_type::rep>
+evaluate(const ArrayExpr<Op, Lhs, Rhs> &expr) {
+  return {expr};
+}
+
+} // namespace qtty
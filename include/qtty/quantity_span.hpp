@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file quantity_span.hpp
+ * @brief Zero-copy typed views over raw value buffers.
+ *
+ * A QuantitySpan reinterprets a buffer of raw values owned elsewhere (an HDF5
+ * reader, a shared-memory segment, a QuantityArray) as quantities of one
+ * unit, without copying:
+ *
+ * @code
+ * double *raw = reader.column("distance_km");
+ * qtty::QuantitySpan<qtty::KilometerTag> km(raw, reader.rows());
+ * qtty::Kilometer longest = qtty::max(km);
+ * auto m = qtty::convert_batch<qtty::Meter>(km); // same memory, now in meters
+ * @endcode
+ */
+
+#include "ffi_core.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+namespace qtty {
+
+// ============================================================================
+// Layout Guarantees
+// ============================================================================
+// A view hands out `Quantity<Tag, Rep>&` into a buffer of `Rep`, which is only
+// sound because a Quantity is nothing but its value. These checks make any
+// change to that layout a compile error instead of silent corruption.
+
+/// True when `Quantity<UnitTag, Rep>` has exactly the layout of a `Rep`.
+template <typename UnitTag, typename Rep>
+inline constexpr bool is_value_layout_v =
+    std::is_standard_layout_v<Quantity<UnitTag, Rep>> &&
+    std::is_trivially_copyable_v<Quantity<UnitTag, Rep>> &&
+    sizeof(Quantity<UnitTag, Rep>) == sizeof(Rep) &&
+    alignof(Quantity<UnitTag, Rep>) == alignof(Rep);
+
+namespace detail {
+
+template <typename Rep>
+inline constexpr bool has_simd_kernels_v =
+    std::is_same_v<Rep, double> || std::is_same_v<Rep, float>;
+
+// Floating values are summed in at least double precision, integers in Rep
+template <typename Rep>
+using accumulate_t = std::conditional_t<std::is_floating_point_v<Rep>, compute_t<Rep>, Rep>;
+
+// Convert `count` values from `FromTag` to `ToTag`; `in` may equal `out`
+template <typename FromTag, typename ToTag, typename Rep>
+void convert_values(const Rep *in, Rep *out, std::size_t count) {
+  static_assert(dimensions_compatible<FromTag, ToTag>(),
+                "Cannot convert between units of different dimensions");
+  if constexpr (std::is_same_v<FromTag, ToTag>) {
+    for (std::size_t i = 0; in != out && i < count; ++i) {
+      out[i] = in[i];
+    }
+  } else if constexpr (has_simd_kernels_v<Rep>) {
+    convert_batch_typed<FromTag, ToTag>(in, out, count);
+  } else if constexpr (has_static_conversion<FromTag, ToTag>()) {
+    constexpr double factor = conversion_factor_v<FromTag, ToTag>;
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = to_rep<Rep>(static_cast<compute_t<Rep>>(in[i]) * factor);
+    }
+  } else if constexpr (is_derived_v<FromTag>) {
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = Quantity<FromTag, Rep>(in[i]).template to<ToTag>().value();
+    }
+  } else {
+    const UnitId from = UnitTraits<FromTag>::unit_id();
+    const UnitId to = UnitTraits<ToTag>::unit_id();
+    double factor;
+    if (linear_conversion_factor(from, to, factor)) {
+      for (std::size_t i = 0; i < count; ++i) {
+        out[i] = to_rep<Rep>(static_cast<compute_t<Rep>>(in[i]) * factor);
+      }
+    } else {
+      for (std::size_t i = 0; i < count; ++i) {
+        out[i] = to_rep<Rep>(convert_value(static_cast<double>(in[i]), from, to));
+      }
+    }
+  }
+}
+
+inline void check_same_size(std::size_t lhs, std::size_t rhs, const char *operation) {
+  if (lhs != rhs) {
+    check_status(QTTY_STATUS_BUFFER_TOO_SMALL, operation);
+  }
+}
+
+// Containers whose data() holds raw values of `UnitTag` (e.g. QuantityArray)
+template <typename Container, typename UnitTag, typename Rep, typename = void>
+struct is_raw_value_container : std::false_type {};
+template <typename Container, typename UnitTag, typename Rep>
+struct is_raw_value_container<
+    Container, UnitTag, Rep,
+    std::void_t<typename Container::unit_tag, decltype(std::declval<Container &>().data()),
+                decltype(std::declval<Container &>().size())>>
+    : std::bool_constant<
+          std::is_same_v<typename Container::unit_tag, UnitTag> &&
+          std::is_convertible_v<decltype(std::declval<Container &>().data()), Rep *>> {};
+
+} // namespace detail
+
+/**
+ * @brief Non-owning view of contiguous `Quantity<UnitTag, Rep>` values.
+ *
+ * Wraps a raw buffer of `Rep` (or of quantities, e.g. a `std::vector<Meter>`)
+ * and exposes it as quantities by reference; nothing is copied and the
+ * buffer must outlive the view. `Rep` may be const-qualified, see
+ * ConstQuantitySpan. A mutable span converts implicitly to a const one.
+ */
+template <typename UnitTag, typename Rep = double> class QuantitySpan {
+public:
+  using unit_tag = UnitTag;
+  using rep = std::remove_const_t<Rep>;
+  using value_type = Quantity<UnitTag, rep>;
+  using element_type = std::conditional_t<std::is_const_v<Rep>, const value_type, value_type>;
+  using size_type = std::size_t;
+  using pointer = element_type *;
+  using reference = element_type &;
+  using iterator = element_type *;
+
+  static_assert(is_value_layout_v<UnitTag, rep>,
+                "Quantity must have exactly the layout of its representation");
+
+  /// Dynamic-extent sentinel for subspan().
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  constexpr QuantitySpan() noexcept = default;
+
+  /// View @p count raw values, each expressed in `UnitTag`.
+  QuantitySpan(Rep *values, size_type count) noexcept
+      : m_data(reinterpret_cast<pointer>(values)), m_size(count) {}
+
+  /// View @p count quantities.
+  constexpr QuantitySpan(pointer quantities, size_type count) noexcept
+      : m_data(quantities), m_size(count) {}
+
+  /// View a container of raw values in `UnitTag` (e.g. a QuantityArray).
+  template <typename Container,
+            std::enable_if_t<detail::is_raw_value_container<Container, UnitTag, Rep>::value,
+                             int> = 0>
+  QuantitySpan(Container &container) noexcept
+      : QuantitySpan(static_cast<Rep *>(container.data()), container.size()) {}
+
+  /// View a container of quantities (e.g. `std::vector<Meter>`).
+  template <typename Container,
+            std::enable_if_t<!std::is_same_v<std::remove_const_t<Container>, QuantitySpan> &&
+                                 std::is_convertible_v<
+                                     decltype(std::declval<Container &>().data()), pointer>,
+                             int> = 0>
+  constexpr QuantitySpan(Container &container) noexcept
+      : QuantitySpan(static_cast<pointer>(container.data()), container.size()) {}
+
+  /// Mutable to const view.
+  template <typename OtherRep,
+            std::enable_if_t<!std::is_same_v<OtherRep, Rep> &&
+                                 std::is_convertible_v<OtherRep *, Rep *>,
+                             int> = 0>
+  constexpr QuantitySpan(const QuantitySpan<UnitTag, OtherRep> &other) noexcept
+      : m_data(other.data()), m_size(other.size()) {}
+
+#if __cplusplus >= 202002L
+  /// View a `std::span` of raw values.
+  QuantitySpan(std::span<Rep> values) noexcept : QuantitySpan(values.data(), values.size()) {}
+
+  /// The viewed buffer as raw values.
+  std::span<Rep> raw() const noexcept { return {raw_data(), m_size}; }
+#endif
+
+  constexpr size_type size() const noexcept { return m_size; }
+  constexpr bool empty() const noexcept { return m_size == 0; }
+
+  constexpr pointer data() const noexcept { return m_data; }
+  Rep *raw_data() const noexcept { return reinterpret_cast<Rep *>(m_data); }
+
+  constexpr iterator begin() const noexcept { return m_data; }
+  constexpr iterator end() const noexcept { return m_data + m_size; }
+
+  constexpr reference operator[](size_type index) const noexcept { return m_data[index]; }
+  constexpr reference front() const noexcept { return m_data[0]; }
+  constexpr reference back() const noexcept { return m_data[m_size - 1]; }
+
+  constexpr QuantitySpan first(size_type count) const noexcept { return {m_data, count}; }
+  constexpr QuantitySpan last(size_type count) const noexcept {
+    return {m_data + (m_size - count), count};
+  }
+  constexpr QuantitySpan subspan(size_type offset, size_type count = npos) const noexcept {
+    return {m_data + offset, count == npos ? m_size - offset : count};
+  }
+
+private:
+  pointer m_data = nullptr;
+  size_type m_size = 0;
+};
+
+/// Read-only view of contiguous `Quantity<UnitTag, Rep>` values.
+template <typename UnitTag, typename Rep = double>
+using ConstQuantitySpan = QuantitySpan<UnitTag, const Rep>;
+
+// ============================================================================
+// Batch Conversion of Views
+// ============================================================================
+// Same strategy as convert_batch() on raw buffers: the dimension check is a
+// static_assert and the factor is resolved once per call.
+
+/**
+ * @brief Convert @p in into @p out (which must have the same size).
+ * @throws QttyException when the sizes differ, or on FFI failure for unit
+ *         pairs without a compile-time factor.
+ */
+template <typename FromTag, typename InRep, typename ToTag, typename Rep>
+void convert_batch(QuantitySpan<FromTag, InRep> in, QuantitySpan<ToTag, Rep> out) {
+  static_assert(std::is_same_v<std::remove_const_t<InRep>, Rep>,
+                "Views must share one non-const output representation");
+  detail::check_same_size(in.size(), out.size(), "convert_batch");
+  detail::convert_values<FromTag, ToTag>(in.raw_data(), out.raw_data(), in.size());
+}
+
+/**
+ * @brief Convert the values of @p data to `ToType` in place.
+ * @return A view of the same memory typed in the target unit.
+ */
+template <typename ToType, typename FromTag, typename Rep,
+          typename = std::enable_if_t<!std::is_const_v<Rep>>>
+QuantitySpan<typename ExtractTag<ToType>::type, Rep>
+convert_batch(QuantitySpan<FromTag, Rep> data) {
+  using ToTag = typename ExtractTag<ToType>::type;
+  detail::convert_values<FromTag, ToTag>(data.raw_data(), data.raw_data(), data.size());
+  return {data.raw_data(), data.size()};
+}
+
+// ============================================================================
+// Reductions
+// ============================================================================
+// min() and max() require a non-empty view; sum() of an empty view is zero.
+// Floating values are summed in at least double precision.
+
+template <typename UnitTag, typename Rep>
+Quantity<UnitTag, std::remove_const_t<Rep>> sum(QuantitySpan<UnitTag, Rep> values) noexcept {
+  using R = std::remove_const_t<Rep>;
+  const Rep *raw = values.raw_data();
+  detail::accumulate_t<R> total = 0;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    total += raw[i];
+  }
+  return Quantity<UnitTag, R>(detail::to_rep<R>(total));
+}
+
+template <typename UnitTag, typename Rep>
+Quantity<UnitTag, std::remove_const_t<Rep>> min(QuantitySpan<UnitTag, Rep> values) noexcept {
+  const Rep *raw = values.raw_data();
+  std::remove_const_t<Rep> best = raw[0];
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    best = raw[i] < best ? raw[i] : best;
+  }
+  return Quantity<UnitTag, std::remove_const_t<Rep>>(best);
+}
+
+template <typename UnitTag, typename Rep>
+Quantity<UnitTag, std::remove_const_t<Rep>> max(QuantitySpan<UnitTag, Rep> values) noexcept {
+  const Rep *raw = values.raw_data();
+  std::remove_const_t<Rep> best = raw[0];
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    best = best < raw[i] ? raw[i] : best;
+  }
+  return Quantity<UnitTag, std::remove_const_t<Rep>>(best);
+}
+
+} // namespace qtty
+
+#if __cplusplus >= 202002L
+// A span views storage it does not own: copying it is O(1) and its iterators
+// stay valid after the span itself is gone.
+namespace std::ranges {
+template <typename UnitTag, typename Rep>
+inline constexpr bool enable_view<qtty::QuantitySpan<UnitTag, Rep>> = true;
+template <typename UnitTag, typename Rep>
+inline constexpr bool enable_borrowed_range<qtty::QuantitySpan<UnitTag, Rep>> = true;
+} // namespace std::ranges
+#endif // __cplusplus >= 202002L
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file ratio.hpp
+ * @brief Correctly rounded evaluation of exact rational conversion factors.
+ *
+ * Units whose definition is an exact rational multiple of the SI unit carry
+ * it as `UnitTraits<Tag>::si_ratio` (a `std::ratio`). A conversion chain, e.g.
+ * Mile → Inch or (Foot / Second) → (Inch / Minute), is the product of a few
+ * such ratios and their reciprocals. Multiplying `std::ratio`s directly would
+ * overflow `intmax_t` for pairs like LightYear → Attometer, so the product is
+ * formed here in fixed-width wide integers and rounded to the nearest double
+ * exactly once:
+ *
+ * @code
+ * // 1609344/1000 ÷ 254/10000 == 63360 exactly; 1609.344 / 0.0254 is not.
+ * static_assert(qtty::detail::ratio_product<2>({1609344, 10000}, {1000, 254}) == 63360.0);
+ * @endcode
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace qtty {
+namespace detail {
+
+/**
+ * @brief Unsigned integer of fixed width, usable in constant expressions.
+ *
+ * 384 bits hold the product of four 63-bit `intmax_t` factors plus the
+ * 55-bit shift applied while dividing.
+ */
+struct WideUint {
+  static constexpr std::size_t kLimbs = 12;
+  std::uint32_t limb[kLimbs] = {};
+};
+
+constexpr WideUint wide_from(std::uint64_t value) noexcept {
+  WideUint out;
+  out.limb[0] = static_cast<std::uint32_t>(value);
+  out.limb[1] = static_cast<std::uint32_t>(value >> 32);
+  return out;
+}
+
+constexpr bool wide_is_zero(const WideUint &a) noexcept {
+  for (std::size_t i = 0; i < WideUint::kLimbs; ++i) {
+    if (a.limb[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr int wide_compare(const WideUint &a, const WideUint &b) noexcept {
+  for (std::size_t i = WideUint::kLimbs; i-- > 0;) {
+    if (a.limb[i] != b.limb[i]) {
+      return a.limb[i] < b.limb[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+constexpr int wide_bit_length(const WideUint &a) noexcept {
+  for (std::size_t i = WideUint::kLimbs; i-- > 0;) {
+    if (a.limb[i] != 0) {
+      int bits = 0;
+      for (std::uint32_t top = a.limb[i]; top != 0; top >>= 1) {
+        ++bits;
+      }
+      return static_cast<int>(i) * 32 + bits;
+    }
+  }
+  return 0;
+}
+
+constexpr WideUint wide_shift_left(const WideUint &a, int bits) noexcept {
+  WideUint out;
+  const std::size_t limbs = static_cast<std::size_t>(bits) / 32;
+  const int rest = bits % 32;
+  for (std::size_t i = WideUint::kLimbs; i-- > limbs;) {
+    std::uint64_t value = static_cast<std::uint64_t>(a.limb[i - limbs]) << rest;
+    if (rest != 0 && i > limbs) {
+      value |= a.limb[i - limbs - 1] >> (32 - rest);
+    }
+    out.limb[i] = static_cast<std::uint32_t>(value);
+  }
+  return out;
+}
+
+// Requires a >= b
+constexpr WideUint wide_subtract(const WideUint &a, const WideUint &b) noexcept {
+  WideUint out;
+  std::uint64_t borrow = 0;
+  for (std::size_t i = 0; i < WideUint::kLimbs; ++i) {
+    const std::uint64_t rhs = static_cast<std::uint64_t>(b.limb[i]) + borrow;
+    borrow = a.limb[i] < rhs ? 1 : 0;
+    out.limb[i] = static_cast<std::uint32_t>((std::uint64_t(1) << 32) * borrow + a.limb[i] - rhs);
+  }
+  return out;
+}
+
+constexpr WideUint wide_multiply(const WideUint &a, std::uint64_t factor) noexcept {
+  const std::uint64_t parts[2] = {factor & 0xffffffffu, factor >> 32};
+  WideUint out;
+  for (std::size_t p = 0; p < 2; ++p) {
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i + p < WideUint::kLimbs; ++i) {
+      const std::uint64_t value =
+          static_cast<std::uint64_t>(a.limb[i]) * parts[p] + out.limb[i + p] + carry;
+      out.limb[i + p] = static_cast<std::uint32_t>(value);
+      carry = value >> 32;
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief `num / den` rounded to the nearest double (ties to even).
+ *
+ * Both operands must be non-zero and the quotient must lie in the normal
+ * double range.
+ */
+constexpr double wide_quotient(WideUint num, WideUint den) noexcept {
+  // Scale so that the integer quotient has 54 or 55 significant bits
+  const int shift = 54 - (wide_bit_length(num) - wide_bit_length(den));
+  if (shift >= 0) {
+    num = wide_shift_left(num, shift);
+  } else {
+    den = wide_shift_left(den, -shift);
+  }
+
+  std::uint64_t quotient = 0;
+  for (int bit = 54; bit >= 0; --bit) {
+    const WideUint step = wide_shift_left(den, bit);
+    if (wide_compare(num, step) >= 0) {
+      num = wide_subtract(num, step);
+      quotient |= std::uint64_t(1) << bit;
+    }
+  }
+
+  // Drop to a 53-bit significand, keeping the round and sticky bits
+  constexpr std::uint64_t kSignificand = std::uint64_t(1) << 53;
+  int exponent = -shift;
+  bool round = false;
+  bool sticky = !wide_is_zero(num);
+  while (quotient >= kSignificand) {
+    sticky = sticky || round;
+    round = (quotient & 1) != 0;
+    quotient >>= 1;
+    ++exponent;
+  }
+  if (round && (sticky || (quotient & 1) != 0)) {
+    ++quotient;
+    if (quotient == kSignificand) {
+      quotient >>= 1;
+      ++exponent;
+    }
+  }
+
+  double result = static_cast<double>(quotient);
+  for (; exponent > 0; --exponent) {
+    result *= 2.0;
+  }
+  for (; exponent < 0; ++exponent) {
+    result *= 0.5;
+  }
+  return result;
+}
+
+/**
+ * @brief `(nums[0] * ... * nums[N-1]) / (dens[0] * ... * dens[N-1])` as the
+ *        nearest double.
+ *
+ * All terms must be positive; N may be at most 4.
+ */
+template <std::size_t N>
+constexpr double ratio_product(const std::intmax_t (&nums)[N],
+                               const std::intmax_t (&dens)[N]) noexcept {
+  static_assert(N >= 1 && N <= 4, "ratio_product supports up to four terms");
+  WideUint num = wide_from(1);
+  WideUint den = wide_from(1);
+  for (std::size_t i = 0; i < N; ++i) {
+    num = wide_multiply(num, static_cast<std::uint64_t>(nums[i]));
+    den = wide_multiply(den, static_cast<std::uint64_t>(dens[i]));
+  }
+  return wide_quotient(num, den);
+}
+
+} // namespace detail
+} // namespace qtty
@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file reduce.hpp
+ * @brief Compensated, reproducible reductions over quantity spans.
+ *
+ * `qtty::reduce::sum`, `mean`, `dot` and `norm` use compensated (Kahan-style
+ * TwoSum) summation over a fixed reduction tree, so they are accurate
+ * to about one rounding of the exact result and return the same bits on
+ * every run, sequentially or with any execution policy and thread count:
+ *
+ * @code
+ * qtty::QuantitySpan<qtty::JouleTag> energy(raw, n);
+ * qtty::Joule total = qtty::reduce::sum(qtty::execution::par, energy);
+ * auto area = qtty::reduce::dot(width.span(), height.span()); // Length x Length
+ * @endcode
+ *
+ * The compensation relies on IEEE evaluation order; do not compile callers
+ * with `-ffast-math` (or `-fassociative-math`).
+ */
+
+#include "ffi_core.hpp"
+#include "parallel.hpp"
+#include "quantity_span.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace qtty {
+
+namespace detail {
+
+/// Independent accumulators per block; element `i` of a block goes to lane
+/// `i % kReduceLanes`, so the loop vectorizes and the shape stays fixed.
+inline constexpr std::size_t kReduceLanes = 8;
+
+// Knuth's TwoSum: adds the exact rounding error of `sum + x` to `comp`.
+// Branch-free, unlike the compare-and-swap form of Neumaier's update.
+template <typename T> inline void two_sum(T &sum, T &comp, T x) noexcept {
+  const T t = sum + x;
+  const T z = t - sum;
+  comp += (sum - (t - z)) + (x - z);
+  sum = t;
+}
+
+// Compensated running sum: `sum + comp` carries the rounding errors of every
+// addition
+template <typename T> struct CompensatedSum {
+  T sum = 0;
+  T comp = 0;
+
+  void add(T x) noexcept { two_sum(sum, comp, x); }
+
+  void merge(const CompensatedSum &other) noexcept {
+    add(other.sum);
+    comp += other.comp;
+  }
+
+  T value() const noexcept { return sum + comp; }
+};
+
+// Compensated sum of load(i) over [begin, end)
+template <typename T, typename Load>
+CompensatedSum<T> reduce_block(std::size_t begin, std::size_t end, const Load &load) noexcept {
+  T sums[kReduceLanes] = {};
+  T comps[kReduceLanes] = {};
+  std::size_t i = begin;
+  for (; i + kReduceLanes <= end; i += kReduceLanes) {
+    for (std::size_t l = 0; l < kReduceLanes; ++l) {
+      two_sum(sums[l], comps[l], load(i + l));
+    }
+  }
+  CompensatedSum<T> lanes[kReduceLanes];
+  for (std::size_t l = 0; l < kReduceLanes; ++l) {
+    lanes[l] = {sums[l], comps[l]};
+  }
+  for (std::size_t l = 0; i < end; ++i, ++l) {
+    lanes[l].add(load(i));
+  }
+  for (std::size_t width = 1; width < kReduceLanes; width *= 2) {
+    for (std::size_t l = 0; l + width < kReduceLanes; l += 2 * width) {
+      lanes[l].merge(lanes[l + width]);
+    }
+  }
+  return lanes[0];
+}
+
+// Pairwise merge of block results [first, last) in a fixed tree
+template <typename T>
+CompensatedSum<T> merge_blocks(const CompensatedSum<T> *blocks, std::size_t first,
+                               std::size_t last) noexcept {
+  if (last - first == 1) {
+    return blocks[first];
+  }
+  const std::size_t mid = first + (last - first) / 2;
+  CompensatedSum<T> result = merge_blocks(blocks, first, mid);
+  result.merge(merge_blocks(blocks, mid, last));
+  return result;
+}
+
+// Compensated sum of load(i) over [0, count): one block per parallel chunk,
+// merged pairwise. `policy` only decides where blocks run.
+template <typename T, typename Policy, typename Load>
+T compensated_sum(Policy &&policy, std::size_t count, const Load &load) {
+  if (count == 0) {
+    return T(0);
+  }
+  std::vector<CompensatedSum<T>> blocks(chunk_count(count));
+  run_chunks(std::forward<Policy>(policy), count, 0,
+             [&](std::size_t begin, std::size_t end, std::size_t c) {
+               blocks[c] = reduce_block<T>(begin, end, load);
+             });
+  return merge_blocks(blocks.data(), 0, blocks.size()).value();
+}
+
+// Floating type of means and norms: Rep itself, or double for integers
+template <typename Rep>
+using real_t = std::conditional_t<std::is_floating_point_v<Rep>, Rep, double>;
+
+// Element i of x * y under the scalar quantity algebra
+template <typename A, typename RA, typename B, typename RB>
+using dot_element_t = decltype(std::declval<Quantity<A, RA>>() * std::declval<Quantity<B, RB>>());
+
+template <typename T> constexpr auto raw_value(const T &value) noexcept {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return value;
+  } else {
+    return value.value();
+  }
+}
+
+template <typename T, typename V> constexpr auto with_value(V value) noexcept {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return static_cast<T>(value);
+  } else {
+    return T(to_rep<typename T::rep>(value));
+  }
+}
+
+} // namespace detail
+
+namespace reduce {
+
+// ============================================================================
+// Sum and Mean
+// ============================================================================
+// Floating values are accumulated in at least double precision with
+// compensated summation; integers are summed exactly in Rep. Blocks of
+// detail::kParallelChunk elements are merged in a fixed pairwise tree, so the
+// sequential and every parallel overload return identical bits.
+
+template <typename Policy, typename UnitTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0>
+Quantity<UnitTag, std::remove_const_t<Rep>> sum(Policy &&policy,
+                                                QuantitySpan<UnitTag, Rep> values) {
+  using R = std::remove_const_t<Rep>;
+  if constexpr (std::is_integral_v<R>) {
+    return qtty::sum(std::forward<Policy>(policy), values);
+  } else {
+    const Rep *raw = values.raw_data();
+    return Quantity<UnitTag, R>(static_cast<R>(detail::compensated_sum<detail::compute_t<R>>(
+        std::forward<Policy>(policy), values.size(),
+        [raw](std::size_t i) { return static_cast<detail::compute_t<R>>(raw[i]); })));
+  }
+}
+
+template <typename UnitTag, typename Rep>
+Quantity<UnitTag, std::remove_const_t<Rep>> sum(QuantitySpan<UnitTag, Rep> values) {
+  return reduce::sum(execution::seq, values);
+}
+
+/// Arithmetic mean; NaN for an empty span. Integral values yield a `double`
+/// mean.
+template <typename Policy, typename UnitTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0>
+Quantity<UnitTag, detail::real_t<std::remove_const_t<Rep>>>
+mean(Policy &&policy, QuantitySpan<UnitTag, Rep> values) {
+  using Real = detail::real_t<std::remove_const_t<Rep>>;
+  if (values.empty()) {
+    return Quantity<UnitTag, Real>(std::numeric_limits<Real>::quiet_NaN());
+  }
+  const Rep *raw = values.raw_data();
+  const auto total = detail::compensated_sum<detail::compute_t<Real>>(
+      std::forward<Policy>(policy), values.size(),
+      [raw](std::size_t i) { return static_cast<detail::compute_t<Real>>(raw[i]); });
+  return Quantity<UnitTag, Real>(static_cast<Real>(total / values.size()));
+}
+
+template <typename UnitTag, typename Rep>
+Quantity<UnitTag, detail::real_t<std::remove_const_t<Rep>>>
+mean(QuantitySpan<UnitTag, Rep> values) {
+  return reduce::mean(execution::seq, values);
+}
+
+// ============================================================================
+// Dot Product and Norm
+// ============================================================================
+// Each product follows the scalar quantity algebra, so the result is typed:
+// Length x Length is an area (`ProductTag`, convertible to `SquareMeter`),
+// velocity x time is a length, and a dimensionless product is a number.
+// Products are rounded once each; their sum is compensated.
+
+/**
+ * @brief Sum of `x[i] * y[i]`.
+ * @throws QttyException when the sizes differ.
+ */
+template <typename Policy, typename A, typename RA, typename B, typename RB,
+          detail::enable_execution_policy_t<Policy> = 0>
+detail::dot_element_t<A, std::remove_const_t<RA>, B, std::remove_const_t<RB>>
+dot(Policy &&policy, QuantitySpan<A, RA> x, QuantitySpan<B, RB> y) {
+  using Element = detail::dot_element_t<A, std::remove_const_t<RA>, B, std::remove_const_t<RB>>;
+  using T = detail::compute_t<std::decay_t<decltype(detail::raw_value(std::declval<Element>()))>>;
+  detail::check_same_size(x.size(), y.size(), "reduce::dot");
+  const T total = detail::compensated_sum<T>(
+      std::forward<Policy>(policy), x.size(),
+      [&x, &y](std::size_t i) { return static_cast<T>(detail::raw_value(x[i] * y[i])); });
+  return detail::with_value<Element>(total);
+}
+
+template <typename A, typename RA, typename B, typename RB>
+detail::dot_element_t<A, std::remove_const_t<RA>, B, std::remove_const_t<RB>>
+dot(QuantitySpan<A, RA> x, QuantitySpan<B, RB> y) {
+  return reduce::dot(execution::seq, x, y);
+}
+
+/// Euclidean norm `sqrt(sum(x[i]^2))`, in the unit of @p x.
+template <typename Policy, typename UnitTag, typename Rep,
+          detail::enable_execution_policy_t<Policy> = 0>
+Quantity<UnitTag, detail::real_t<std::remove_const_t<Rep>>>
+norm(Policy &&policy, QuantitySpan<UnitTag, Rep> x) {
+  using Real = detail::real_t<std::remove_const_t<Rep>>;
+  using T = detail::compute_t<Real>;
+  const Rep *raw = x.raw_data();
+  const T squares = detail::compensated_sum<T>(std::forward<Policy>(policy), x.size(),
+                                               [raw](std::size_t i) {
+                                                 const T v = static_cast<T>(raw[i]);
+                                                 return v * v;
+                                               });
+  return Quantity<UnitTag, Real>(static_cast<Real>(std::sqrt(squares)));
+}
+
+template <typename UnitTag, typename Rep>
+Quantity<UnitTag, detail::real_t<std::remove_const_t<Rep>>> norm(QuantitySpan<UnitTag, Rep> x) {
+  return reduce::norm(execution::seq, x);
+}
+
+} // namespace reduce
+
+} // namespace qtty
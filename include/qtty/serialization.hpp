@@ -6,16 +6,38 @@
 /**
  * @file serialization.hpp
  * @brief JSON serialization helpers for qtty quantities.
+ *
+ * The value-only and `{"value":<f64>,"unit_id":<u32>}` formats are written
+ * and parsed in C++ (`std::to_chars` / `std::from_chars`), byte-identical to
+ * the serde_json output of qtty-ffi; debug builds check every result against
+ * qtty-ffi (see `QTTY_JSON_VERIFY`). Compound quantities and inputs outside
+ * the canonical form go through qtty-ffi.
+ *
+ * Parsing is length-delimited: every `from_json*` takes a `std::string_view`
+ * or `(pointer, length)`, so fields can be read in place from a larger
+ * buffer without NUL terminators.
  */
 
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 extern "C" {
 #include "qtty_ffi.h"
 }
 #include "ffi_core.hpp"
+#include "quantity_array.hpp"
+#include "quantity_span.hpp"
 
 // Forward declarations for JSON-related FFI functions. These may not be present
 // in older generated headers; we declare them here to ensure availability at
@@ -31,6 +53,76 @@ void qtty_string_free(char *s);
 }
 
 namespace qtty {
+
+/**
+ * @brief Move-only owner of a string allocated by qtty-ffi.
+ *
+ * Holds the text the FFI returned, exposed as a `std::string_view`, and
+ * frees it with `qtty_string_free` on destruction. Use it instead of a
+ * `std::string` copy when the text only needs to be written somewhere:
+ *
+ * @code
+ * qtty::FfiString json = qtty::derived_serialization::to_ffi_json(speed);
+ * std::fwrite(json.data(), 1, json.size(), out);
+ * @endcode
+ */
+class FfiString {
+public:
+  FfiString() noexcept = default;
+
+  /// Take ownership of @p ptr (allocated by qtty-ffi, may be null).
+  explicit FfiString(char *ptr) noexcept : m_ptr(ptr), m_size(ptr ? std::strlen(ptr) : 0) {}
+
+  FfiString(FfiString &&other) noexcept
+      : m_ptr(std::exchange(other.m_ptr, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+  FfiString &operator=(FfiString &&other) noexcept {
+    if (this != &other) {
+      reset();
+      m_ptr = std::exchange(other.m_ptr, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+  }
+
+  FfiString(const FfiString &) = delete;
+  FfiString &operator=(const FfiString &) = delete;
+
+  ~FfiString() { reset(); }
+
+  /// The text; empty when nothing is held.
+  std::string_view view() const noexcept { return {m_ptr ? m_ptr : "", m_size}; }
+  operator std::string_view() const noexcept { return view(); }
+
+  /// NUL-terminated text; "" when nothing is held.
+  const char *c_str() const noexcept { return m_ptr ? m_ptr : ""; }
+  const char *data() const noexcept { return c_str(); }
+  std::size_t size() const noexcept { return m_size; }
+  bool empty() const noexcept { return m_size == 0; }
+
+  /// Copy of the text.
+  std::string str() const { return std::string(view()); }
+
+  /// Give up ownership; the caller must pass the result to `qtty_string_free`.
+  char *release() noexcept {
+    m_size = 0;
+    return std::exchange(m_ptr, nullptr);
+  }
+
+  /// Free the held string and take ownership of @p ptr.
+  void reset(char *ptr = nullptr) noexcept {
+    if (m_ptr) {
+      qtty_string_free(m_ptr);
+    }
+    m_ptr = ptr;
+    m_size = ptr ? std::strlen(ptr) : 0;
+  }
+
+private:
+  char *m_ptr = nullptr;
+  std::size_t m_size = 0;
+};
+
 namespace serialization {
 
 // Thin wrappers over Rust FFI JSON serialize/deserialize.
@@ -40,69 +132,770 @@ namespace serialization {
  * @brief Convert an owned C string from FFI into std::string and free it.
  * @param ptr Pointer allocated by qtty-ffi.
  * @return Copied C++ string (or empty when @p ptr is null).
+ * @see FfiString to keep the FFI buffer instead of copying it.
  */
-inline std::string from_owned_c(char *ptr) {
-  if (!ptr)
-    return {};
-  std::string s(ptr);
-  // Free via FFI allocator
-  qtty_string_free(ptr);
-  return s;
+inline std::string from_owned_c(char *ptr) { return FfiString(ptr).str(); }
+
+} // namespace serialization
+
+// ============================================================================
+// Native JSON
+// ============================================================================
+// serde_json writes an f64 with ryu: the shortest digits that round-trip,
+// in plain notation when the decimal point falls within 16 digits (`42.5`,
+// `1000000000000000.0`, `0.00001`) and as `<d>[.<ddd>]e<exp>` otherwise
+// (`1e16`, `1e-7`); NaN and infinities become `null`. The writer below
+// reproduces that from the shortest digits of std::to_chars. The reader
+// accepts exactly the JSON number grammar and parses it with std::from_chars,
+// which rounds correctly (as serde_json's `float_roundtrip` feature does; the
+// default serde_json parser can be 1 ULP off beyond 15 significant digits).
+
+/// 1 when std::to_chars / std::from_chars support `double`; otherwise every
+/// JSON call goes through qtty-ffi.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define QTTY_HAS_NATIVE_JSON 1
+#else
+#define QTTY_HAS_NATIVE_JSON 0
+#endif
+
+/// When 1, every native JSON result is compared with qtty-ffi and a mismatch
+/// aborts. Defaults to 1 in builds without `NDEBUG`.
+#ifndef QTTY_JSON_VERIFY
+#if QTTY_HAS_NATIVE_JSON && !defined(NDEBUG)
+#define QTTY_JSON_VERIFY 1
+#else
+#define QTTY_JSON_VERIFY 0
+#endif
+#endif
+
+namespace serialization {
+
+/// Longest to_json_value() output, e.g. `-1.2345678901234567e-308`.
+inline constexpr std::size_t kMaxJsonValueSize = 24;
+
+/// Longest to_json() output: `{"value":`, a value, `,"unit_id":`, a u32, `}`.
+inline constexpr std::size_t kMaxJsonSize = 9 + kMaxJsonValueSize + 11 + 10 + 1;
+
+} // namespace serialization
+
+namespace detail {
+
+// qtty-ffi serialization of (value, unit): the bare value, or the object
+inline Result<FfiString> ffi_to_json(double value, UnitId unit, bool object) noexcept {
+  qtty_quantity_t src{};
+  int32_t status = qtty_quantity_make(value, unit, &src);
+  if (status != QTTY_STATUS_OK) {
+    return Result<FfiString>::from_status(static_cast<QttyStatus>(status));
+  }
+
+  char *out = nullptr;
+  status = object ? qtty_quantity_to_json(src, &out) : qtty_quantity_to_json_value(src, &out);
+  FfiString json(out);
+  if (status != QTTY_STATUS_OK) {
+    return Result<FfiString>::from_status(static_cast<QttyStatus>(status));
+  }
+  return json;
+}
+
+// Copy of a Result<FfiString> as a Result<std::string>
+inline Result<std::string> to_std_string(const Result<FfiString> &json) {
+  if (!json) {
+    return Result<std::string>::from_status(json.status());
+  }
+  return json->str();
+}
+
+// Copy [json, json_end) into the caller's buffer
+inline Result<std::size_t> copy_json(const char *json, const char *json_end, char *buffer,
+                                     std::size_t size) noexcept {
+  const std::size_t length = static_cast<std::size_t>(json_end - json);
+  if (length > size) {
+    return Result<std::size_t>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
+  std::memcpy(buffer, json, length);
+  return length;
+}
+
+// NUL-terminated copy of length-delimited JSON for the C entry points: on the
+// stack when short, otherwise on the heap (c_str() is null if that fails)
+class NulTerminated {
+public:
+  NulTerminated(std::string_view text) noexcept {
+    if (text.size() >= sizeof(m_small)) {
+      m_heap = new (std::nothrow) char[text.size() + 1];
+    }
+    char *copy = text.size() < sizeof(m_small) ? m_small : m_heap;
+    if (copy) {
+      std::memcpy(copy, text.data(), text.size());
+      copy[text.size()] = '\0';
+    }
+    m_text = copy;
+  }
+  ~NulTerminated() { delete[] m_heap; }
+
+  NulTerminated(const NulTerminated &) = delete;
+  NulTerminated &operator=(const NulTerminated &) = delete;
+
+  const char *c_str() const noexcept { return m_text; }
+
+private:
+  char m_small[256];
+  char *m_heap = nullptr;
+  const char *m_text = nullptr;
+};
+
+#if QTTY_HAS_NATIVE_JSON
+
+// serde_json text of @p value at @p out (room for kMaxJsonValueSize chars)
+inline char *write_json_number(char *out, double value) noexcept {
+  if (!std::isfinite(value)) {
+    std::memcpy(out, "null", 4);
+    return out + 4;
+  }
+  // Shortest round-trip digits, as `-d.ddde+XX`
+  char sci[32];
+  const char *sci_end =
+      std::to_chars(sci, sci + sizeof(sci), value, std::chars_format::scientific).ptr;
+  const char *p = sci;
+  if (*p == '-') {
+    *out++ = '-';
+    ++p;
+  }
+  char digits[17];
+  int length = 0;
+  for (; *p != 'e'; ++p) {
+    if (*p != '.') {
+      digits[length++] = *p;
+    }
+  }
+  int exponent = 0;
+  p += p[1] == '+' ? 2 : 1;
+  std::from_chars(p, sci_end, exponent);
+
+  const int point = exponent + 1; // decimal point position relative to the digits
+  if (length <= point && point <= 16) {
+    // 1234e7 -> 12340000000.0
+    std::memcpy(out, digits, length);
+    std::memset(out + length, '0', point - length);
+    out += point;
+    *out++ = '.';
+    *out++ = '0';
+  } else if (0 < point && point <= 16) {
+    // 1234e-2 -> 12.34
+    std::memcpy(out, digits, point);
+    out[point] = '.';
+    std::memcpy(out + point + 1, digits + point, length - point);
+    out += length + 1;
+  } else if (-5 < point && point <= 0) {
+    // 1234e-6 -> 0.001234
+    *out++ = '0';
+    *out++ = '.';
+    std::memset(out, '0', -point);
+    out += -point;
+    std::memcpy(out, digits, length);
+    out += length;
+  } else {
+    // 1234e30 -> 1.234e33
+    *out++ = digits[0];
+    if (length > 1) {
+      *out++ = '.';
+      std::memcpy(out, digits + 1, length - 1);
+      out += length - 1;
+    }
+    *out++ = 'e';
+    out = std::to_chars(out, out + 5, point - 1).ptr;
+  }
+  return out;
 }
 
+// `{"value":<number>,"unit_id":<id>}` at @p out (room for kMaxJsonSize chars)
+inline char *write_json_object(char *out, double value, UnitId unit) noexcept {
+  std::memcpy(out, "{\"value\":", 9);
+  out = write_json_number(out + 9, value);
+  std::memcpy(out, ",\"unit_id\":", 11);
+  out = std::to_chars(out + 11, out + 21, static_cast<std::uint32_t>(unit)).ptr;
+  *out++ = '}';
+  return out;
+}
+
+#endif // QTTY_HAS_NATIVE_JSON
+
+// Reader for the canonical forms. Any failure means "not canonical" and the
+// caller hands the input to qtty-ffi, which also reports the errors. Without
+// native JSON, number() always fails, so every number goes to qtty-ffi.
+class JsonCursor {
+public:
+  constexpr JsonCursor(std::string_view json) noexcept
+      : m_pos(json.data()), m_end(json.data() + json.size()) {}
+
+  const char *position() const noexcept { return m_pos; }
+  void seek(const char *pos) noexcept { m_pos = pos; }
+
+  bool peek(char c) noexcept {
+    skip_whitespace();
+    return m_pos != m_end && *m_pos == c;
+  }
+
+  bool consume(char c) noexcept {
+    if (!peek(c)) {
+      return false;
+    }
+    ++m_pos;
+    return true;
+  }
+
+  // `"<key>"` followed by `:`; keys with escapes are left to qtty-ffi
+  bool key(std::string_view name) noexcept {
+    skip_whitespace();
+    const std::size_t length = name.size() + 2;
+    if (static_cast<std::size_t>(m_end - m_pos) < length || m_pos[0] != '"' ||
+        m_pos[length - 1] != '"' || std::memcmp(m_pos + 1, name.data(), name.size()) != 0) {
+      return false;
+    }
+    m_pos += length;
+    return consume(':');
+  }
+
+  // One JSON number; from_chars alone would also take `.5`, `01` or `inf`
+  bool number(double &out) noexcept {
+    skip_whitespace();
+    const char *p = m_pos;
+    if (p != m_end && *p == '-') {
+      ++p;
+    }
+    if (!digits(p, true)) {
+      return false;
+    }
+    if (p != m_end && *p == '.' && !digits(++p, false)) {
+      return false;
+    }
+    if (p != m_end && (*p == 'e' || *p == 'E')) {
+      ++p;
+      if (p != m_end && (*p == '+' || *p == '-')) {
+        ++p;
+      }
+      if (!digits(p, false)) {
+        return false;
+      }
+    }
+#if QTTY_HAS_NATIVE_JSON
+    const std::from_chars_result result = std::from_chars(m_pos, p, out);
+    if (result.ec != std::errc{} || result.ptr != p) {
+      return false; // out of range: serde's over/underflow rules apply
+    }
+    m_pos = p;
+    return true;
+#else
+    (void)out;
+    return false;
+#endif
+  }
+
+  bool unit_id(UnitId &out) noexcept {
+    skip_whitespace();
+    const char *p = m_pos;
+    std::uint32_t raw = 0;
+    if (!digits(p, true)) {
+      return false;
+    }
+    const std::from_chars_result result = std::from_chars(m_pos, p, raw);
+    if (result.ec != std::errc{}) {
+      return false;
+    }
+    out = static_cast<UnitId>(raw);
+    m_pos = p;
+    return true;
+  }
+
+  // `{"value":<number>,"unit_id":<id>}`, in either field order
+  bool quantity(double &value, UnitId &unit) noexcept {
+    if (!consume('{')) {
+      return false;
+    }
+    bool has_value = false;
+    bool has_unit = false;
+    for (int field = 0; field < 2; ++field) {
+      if (field == 1 && !consume(',')) {
+        return false;
+      }
+      if (!has_value && key("value")) {
+        has_value = number(value);
+        if (!has_value) {
+          return false;
+        }
+      } else if (!has_unit && key("unit_id")) {
+        has_unit = unit_id(unit);
+        if (!has_unit) {
+          return false;
+        }
+      } else {
+        return false;
+      }
+    }
+    return consume('}');
+  }
+
+  // Skip one JSON value of any kind (to hand it to qtty-ffi); stops at the
+  // `,` or closing bracket that follows it
+  bool skip_value() noexcept {
+    skip_whitespace();
+    const char *start = m_pos;
+    int depth = 0;
+    for (; m_pos != m_end; ++m_pos) {
+      const char c = *m_pos;
+      if (c == '"') {
+        for (++m_pos; m_pos != m_end && *m_pos != '"'; ++m_pos) {
+          if (*m_pos == '\\' && m_pos + 1 != m_end) {
+            ++m_pos;
+          }
+        }
+        if (m_pos == m_end) {
+          break;
+        }
+      } else if (c == '{' || c == '[') {
+        ++depth;
+      } else if (c == '}' || c == ']') {
+        if (depth-- == 0) {
+          break;
+        }
+      } else if (c == ',' && depth == 0) {
+        break;
+      }
+    }
+    return m_pos != start && depth <= 0;
+  }
+
+  bool at_end() noexcept {
+    skip_whitespace();
+    return m_pos == m_end;
+  }
+
+private:
+  void skip_whitespace() noexcept {
+    while (m_pos != m_end &&
+           (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t')) {
+      ++m_pos;
+    }
+  }
+
+  // [0-9]+ at p, without a leading zero when `integer`
+  bool digits(const char *&p, bool integer) const noexcept {
+    const char *start = p;
+    while (p != m_end && *p >= '0' && *p <= '9') {
+      ++p;
+    }
+    return p != start && !(integer && *start == '0' && p - start > 1);
+  }
+
+  const char *m_pos;
+  const char *m_end;
+};
+
+// A bare JSON number
+inline bool parse_json_value(std::string_view json, double &value) noexcept {
+  JsonCursor cursor(json);
+  return cursor.number(value) && cursor.at_end();
+}
+
+// `{"value":<number>,"unit_id":<id>}`, in either field order
+inline bool parse_json_object(std::string_view json, double &value, UnitId &unit) noexcept {
+  JsonCursor cursor(json);
+  return cursor.quantity(value, unit) && cursor.at_end();
+}
+
+#if QTTY_JSON_VERIFY
+
+[[noreturn]] inline void json_verify_failed(const char *what, std::string_view json) noexcept {
+  std::fprintf(stderr, "qtty: native JSON %s disagrees with qtty-ffi for `%.*s`\n", what,
+               static_cast<int>(json.size()), json.data());
+  std::abort();
+}
+
+// Compare native output with qtty-ffi's serialization of the same quantity
+inline void verify_json_output(std::string_view json, double value, UnitId unit,
+                               bool object) noexcept {
+  const Result<FfiString> ffi = ffi_to_json(value, unit, object);
+  if (!ffi || json != ffi->view()) {
+    json_verify_failed("output", json);
+  }
+}
+
+// Compare a native parse with qtty-ffi's. Values may differ by 1 ULP (see
+// above). Input qtty-ffi rejects (e.g. an unknown unit_id) is not a mismatch:
+// its status is returned for the caller to report.
+inline QttyStatus verify_json_input(std::string_view json, double value, UnitId unit,
+                                    bool object) noexcept {
+  const NulTerminated text(json);
+  if (!text.c_str()) {
+    return QTTY_STATUS_OK;
+  }
+  qtty_quantity_t out{};
+  const int32_t status = object ? qtty_quantity_from_json(text.c_str(), &out)
+                                : qtty_quantity_from_json_value(unit, text.c_str(), &out);
+  if (status != QTTY_STATUS_OK) {
+    return static_cast<QttyStatus>(status);
+  }
+  if (out.unit != unit || (out.value != value && std::nextafter(out.value, value) != value)) {
+    json_verify_failed("input", json);
+  }
+  return QTTY_STATUS_OK;
+}
+
+#endif // QTTY_JSON_VERIFY
+
+// qtty-ffi parse of one JSON number the native reader rejected
+inline QttyStatus ffi_json_number(std::string_view json, UnitId unit, double &value) noexcept {
+  const NulTerminated text(json);
+  if (!text.c_str()) {
+    return QTTY_STATUS_BUFFER_TOO_SMALL;
+  }
+  qtty_quantity_t out{};
+  const int32_t status = qtty_quantity_from_json_value(unit, text.c_str(), &out);
+  value = out.value;
+  return static_cast<QttyStatus>(status);
+}
+
+// qtty-ffi parse of one `{"value","unit_id"}` object the native reader rejected
+inline QttyStatus ffi_json_quantity(std::string_view json, double &value, UnitId &unit) noexcept {
+  const NulTerminated text(json);
+  if (!text.c_str()) {
+    return QTTY_STATUS_BUFFER_TOO_SMALL;
+  }
+  qtty_quantity_t out{};
+  const int32_t status = qtty_quantity_from_json(text.c_str(), &out);
+  value = out.value;
+  unit = out.unit;
+  return static_cast<QttyStatus>(status);
+}
+
+// The status qtty-ffi reports for malformed JSON (here, empty input), used for
+// structural errors found by the native array reader
+inline QttyStatus json_syntax_error(UnitId unit) noexcept {
+  qtty_quantity_t out{};
+  const int32_t status = qtty_quantity_from_json_value(unit, "", &out);
+  return status != QTTY_STATUS_OK ? static_cast<QttyStatus>(status) : QTTY_STATUS_NULL_OUT;
+}
+
+// Elements of a JSON array into @p values: numbers (in a unit known to the
+// caller), or with @p units, `{"value","unit_id"}` objects. Elements the
+// native reader rejects are parsed by qtty-ffi one at a time; @p unit is only
+// passed along to it.
+inline QttyStatus read_json_elements(JsonCursor &cursor, UnitId unit, std::vector<double> &values,
+                                     std::vector<UnitId> *units) {
+  if (!cursor.consume('[')) {
+    return json_syntax_error(unit);
+  }
+  if (cursor.consume(']')) {
+    return QTTY_STATUS_OK;
+  }
+  do {
+    const char *start = cursor.position();
+    double value = 0.0;
+    UnitId element_unit = unit;
+    if (units ? cursor.quantity(value, element_unit) : cursor.number(value)) {
+#if QTTY_JSON_VERIFY
+      const QttyStatus status =
+          verify_json_input({start, static_cast<std::size_t>(cursor.position() - start)}, value,
+                            element_unit, units != nullptr);
+      if (status != QTTY_STATUS_OK) {
+        return status;
+      }
+#endif
+    } else {
+      cursor.seek(start);
+      if (!cursor.skip_value()) {
+        return json_syntax_error(unit);
+      }
+      const std::string_view text(start, static_cast<std::size_t>(cursor.position() - start));
+      const QttyStatus status = units ? ffi_json_quantity(text, value, element_unit)
+                                      : ffi_json_number(text, unit, value);
+      if (status != QTTY_STATUS_OK) {
+        return status;
+      }
+    }
+    values.push_back(value);
+    if (units) {
+      units->push_back(element_unit);
+    }
+  } while (cursor.consume(','));
+  return cursor.consume(']') ? QTTY_STATUS_OK : json_syntax_error(unit);
+}
+
+// Any from_json_array() input form into @p values, expressed in @p target
+inline QttyStatus read_json_array(std::string_view json, UnitId target,
+                                  std::vector<double> &values) {
+  JsonCursor cursor(json);
+  QttyStatus status = QTTY_STATUS_OK;
+  if (cursor.consume('{')) {
+    // {"unit_id":<id>,"values":[...]}, in either field order
+    UnitId unit{};
+    bool has_unit = false;
+    bool has_values = false;
+    for (int field = 0; field < 2; ++field) {
+      if (field == 1 && !cursor.consume(',')) {
+        return json_syntax_error(target);
+      }
+      if (!has_unit && cursor.key("unit_id")) {
+        has_unit = cursor.unit_id(unit);
+        if (!has_unit) {
+          return json_syntax_error(target);
+        }
+      } else if (!has_values && cursor.key("values")) {
+        has_values = true;
+        status = read_json_elements(cursor, target, values, nullptr);
+        if (status != QTTY_STATUS_OK) {
+          return status;
+        }
+      } else {
+        return json_syntax_error(target);
+      }
+    }
+    if (!cursor.consume('}')) {
+      return json_syntax_error(target);
+    }
+    status = try_convert_batch_runtime(unit, target, values.data(), values.data(), values.size());
+  } else {
+    // [<number>,...] in the target unit, or [{"value","unit_id"},...]
+    JsonCursor probe = cursor;
+    const bool objects = probe.consume('[') && probe.peek('{');
+    std::vector<UnitId> units;
+    status = read_json_elements(cursor, target, values, objects ? &units : nullptr);
+    // Convert each run of equal units in one pass
+    for (std::size_t first = 0; status == QTTY_STATUS_OK && first < units.size();) {
+      std::size_t last = first + 1;
+      while (last < units.size() && units[last] == units[first]) {
+        ++last;
+      }
+      double *run = values.data() + first;
+      status = try_convert_batch_runtime(units[first], target, run, run, last - first);
+      first = last;
+    }
+  }
+  if (status != QTTY_STATUS_OK) {
+    return status;
+  }
+  return cursor.at_end() ? QTTY_STATUS_OK : json_syntax_error(target);
+}
+
+} // namespace detail
+
+namespace serialization {
+
+// Every function comes in two flavours: the plain one throws on failure
+// (through check_status()), the `try_` one returns a Result carrying the
+// QttyStatus instead and is usable in -fno-exceptions builds.
+
 // Serialize only the numeric value as a JSON number string.
 // Mirrors Rust's default serde for quantities.
 
+/**
+ * @brief Write the value-only JSON of @p q into a caller buffer, without throwing.
+ *
+ * Writes at most kMaxJsonValueSize characters and no terminating NUL. Does
+ * not allocate when QTTY_HAS_NATIVE_JSON is 1.
+ * @param q Source quantity (its value is written as a double).
+ * @param buffer Destination characters.
+ * @param size Capacity of @p buffer.
+ * @return Number of characters written, or `QTTY_STATUS_BUFFER_TOO_SMALL`.
+ */
+template <typename UnitTag, typename Rep>
+Result<std::size_t> try_to_json_value(const Quantity<UnitTag, Rep> &q, char *buffer,
+                                      std::size_t size) {
+  const double value = static_cast<double>(q.value());
+#if QTTY_HAS_NATIVE_JSON
+  char json[kMaxJsonValueSize];
+  const char *json_end = detail::write_json_number(json, value);
+#if QTTY_JSON_VERIFY
+  detail::verify_json_output({json, static_cast<std::size_t>(json_end - json)}, value,
+                             UnitTraits<UnitTag>::unit_id(), false);
+#endif
+  return detail::copy_json(json, json_end, buffer, size);
+#else
+  const Result<FfiString> json = detail::ffi_to_json(value, UnitTraits<UnitTag>::unit_id(), false);
+  if (!json) {
+    return Result<std::size_t>::from_status(json.status());
+  }
+  return detail::copy_json(json->data(), json->data() + json->size(), buffer, size);
+#endif
+}
+
+/**
+ * @brief Write the value-only JSON of @p q into a caller buffer.
+ * @return Number of characters written (no terminating NUL).
+ * @throws QttyException when @p size is too small (see kMaxJsonValueSize).
+ */
+template <typename UnitTag, typename Rep>
+std::size_t to_json_value(const Quantity<UnitTag, Rep> &q, char *buffer, std::size_t size) {
+  Result<std::size_t> written = try_to_json_value(q, buffer, size);
+  check_status(written.status(), "Serializing value to JSON");
+  return *written;
+}
+
+/**
+ * @brief Serialize only the numeric value as JSON, without throwing.
+ * @tparam UnitTag Unit tag of the source quantity.
+ * @tparam Rep Representation of the source quantity (sent as a double).
+ * @param q Source quantity.
+ * @return JSON string representing only the value, or the failing status.
+ */
+template <typename UnitTag, typename Rep>
+Result<std::string> try_to_json_value(const Quantity<UnitTag, Rep> &q) {
+#if QTTY_HAS_NATIVE_JSON
+  char json[kMaxJsonValueSize];
+  return std::string(json, *try_to_json_value(q, json, sizeof(json)));
+#else
+  return detail::to_std_string(
+      detail::ffi_to_json(static_cast<double>(q.value()), UnitTraits<UnitTag>::unit_id(), false));
+#endif
+}
+
 /**
  * @brief Serialize only the numeric value as JSON for a typed quantity.
  * @tparam UnitTag Unit tag of the source quantity.
+ * @tparam Rep Representation of the source quantity (sent as a double).
  * @param q Source quantity.
  * @return JSON string representing only the value.
  */
-template <typename UnitTag> std::string to_json_value(const Quantity<UnitTag> &q) {
-  qtty_quantity_t src{};
-  int32_t status = qtty_quantity_make(q.value(), UnitTraits<UnitTag>::unit_id(), &src);
-  check_status(static_cast<QttyStatus>(status), "Creating source quantity for to_json_value");
-
-  char *out = nullptr;
-  status = qtty_quantity_to_json_value(src, &out);
-  check_status(static_cast<QttyStatus>(status), "Serializing value to JSON");
-  return from_owned_c(out);
+template <typename UnitTag, typename Rep>
+std::string to_json_value(const Quantity<UnitTag, Rep> &q) {
+  Result<std::string> json = try_to_json_value(q);
+  check_status(json.status(), "Serializing value to JSON");
+  return std::move(*json);
 }
 
 /**
- * @brief Deserialize a JSON numeric value into a typed quantity.
- * @tparam T Unit tag or Quantity type of the target.
- * @param json JSON input string view.
- * @return Deserialized typed quantity.
+ * @brief Deserialize a JSON numeric value into a typed quantity, without throwing.
+ * @tparam T Unit tag or Quantity type of the target; a Quantity type also
+ *           selects the representation (double for bare tags).
+ * @param json JSON text; need not be NUL-terminated.
+ * @return Deserialized typed quantity, or the failing status.
  */
 template <typename T>
-Quantity<typename ExtractTag<T>::type> from_json_value(std::string_view json) {
+Result<quantity_type_t<T>> try_from_json_value(std::string_view json) noexcept {
   using UnitTag = typename ExtractTag<T>::type;
+#if QTTY_HAS_NATIVE_JSON
+  double value = 0.0;
+  if (detail::parse_json_value(json, value)) {
+#if QTTY_JSON_VERIFY
+    const QttyStatus checked =
+        detail::verify_json_input(json, value, UnitTraits<UnitTag>::unit_id(), false);
+    if (checked != QTTY_STATUS_OK) {
+      return Result<quantity_type_t<T>>::from_status(checked);
+    }
+#endif
+    return quantity_type_t<T>(detail::to_rep<typename ExtractRep<T>::type>(value));
+  }
+#endif
+  const detail::NulTerminated text(json);
+  if (!text.c_str()) {
+    return Result<quantity_type_t<T>>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
   qtty_quantity_t out_qty{};
   int32_t status =
-      qtty_quantity_from_json_value(UnitTraits<UnitTag>::unit_id(), json.data(), &out_qty);
-  check_status(static_cast<QttyStatus>(status), "Deserializing value from JSON");
-  return Quantity<UnitTag>(out_qty.value);
+      qtty_quantity_from_json_value(UnitTraits<UnitTag>::unit_id(), text.c_str(), &out_qty);
+  if (status != QTTY_STATUS_OK) {
+    return Result<quantity_type_t<T>>::from_status(static_cast<QttyStatus>(status));
+  }
+  return quantity_type_t<T>(detail::to_rep<typename ExtractRep<T>::type>(out_qty.value));
+}
+
+/**
+ * @brief Deserialize a JSON numeric value into a typed quantity.
+ * @tparam T Unit tag or Quantity type of the target; a Quantity type also
+ *           selects the representation (double for bare tags).
+ * @param json JSON text; need not be NUL-terminated.
+ * @return Deserialized typed quantity.
+ */
+template <typename T>
+quantity_type_t<T> from_json_value(std::string_view json) {
+  auto result = try_from_json_value<T>(json);
+  check_status(result.status(), "Deserializing value from JSON");
+  return *result;
+}
+
+/// try_from_json_value() of the @p length characters at @p json, e.g. a field
+/// inside a larger receive buffer; no NUL terminator is needed.
+template <typename T>
+Result<quantity_type_t<T>> try_from_json_value(const char *json, std::size_t length) noexcept {
+  return try_from_json_value<T>(std::string_view(json, length));
+}
+
+/// from_json_value() of the @p length characters at @p json.
+template <typename T> quantity_type_t<T> from_json_value(const char *json, std::size_t length) {
+  return from_json_value<T>(std::string_view(json, length));
 }
 
 // Serialize value and unit_id into an object {"value":<f64>, "unit_id":<u32>}.
 
+/**
+ * @brief Write the `{"value","unit_id"}` JSON of @p q into a caller buffer,
+ *        without throwing.
+ *
+ * Writes at most kMaxJsonSize characters and no terminating NUL. Does not
+ * allocate when QTTY_HAS_NATIVE_JSON is 1.
+ * @return Number of characters written, or `QTTY_STATUS_BUFFER_TOO_SMALL`.
+ */
+template <typename UnitTag, typename Rep>
+Result<std::size_t> try_to_json(const Quantity<UnitTag, Rep> &q, char *buffer, std::size_t size) {
+  const double value = static_cast<double>(q.value());
+#if QTTY_HAS_NATIVE_JSON
+  char json[kMaxJsonSize];
+  const char *json_end = detail::write_json_object(json, value, UnitTraits<UnitTag>::unit_id());
+#if QTTY_JSON_VERIFY
+  detail::verify_json_output({json, static_cast<std::size_t>(json_end - json)}, value,
+                             UnitTraits<UnitTag>::unit_id(), true);
+#endif
+  return detail::copy_json(json, json_end, buffer, size);
+#else
+  const Result<FfiString> json = detail::ffi_to_json(value, UnitTraits<UnitTag>::unit_id(), true);
+  if (!json) {
+    return Result<std::size_t>::from_status(json.status());
+  }
+  return detail::copy_json(json->data(), json->data() + json->size(), buffer, size);
+#endif
+}
+
+/**
+ * @brief Write the `{"value","unit_id"}` JSON of @p q into a caller buffer.
+ * @return Number of characters written (no terminating NUL).
+ * @throws QttyException when @p size is too small (see kMaxJsonSize).
+ */
+template <typename UnitTag, typename Rep>
+std::size_t to_json(const Quantity<UnitTag, Rep> &q, char *buffer, std::size_t size) {
+  Result<std::size_t> written = try_to_json(q, buffer, size);
+  check_status(written.status(), "Serializing quantity to JSON");
+  return *written;
+}
+
+/**
+ * @brief Serialize a typed quantity as JSON object, without throwing.
+ * @tparam UnitTag Unit tag of the source quantity.
+ * @tparam Rep Representation of the source quantity (sent as a double).
+ * @param q Source quantity.
+ * @return JSON object string with value/unit_id fields, or the failing status.
+ */
+template <typename UnitTag, typename Rep>
+Result<std::string> try_to_json(const Quantity<UnitTag, Rep> &q) {
+#if QTTY_HAS_NATIVE_JSON
+  char json[kMaxJsonSize];
+  return std::string(json, *try_to_json(q, json, sizeof(json)));
+#else
+  return detail::to_std_string(
+      detail::ffi_to_json(static_cast<double>(q.value()), UnitTraits<UnitTag>::unit_id(), true));
+#endif
+}
+
 /**
  * @brief Serialize a typed quantity as JSON object with value and unit id.
  * @tparam UnitTag Unit tag of the source quantity.
+ * @tparam Rep Representation of the source quantity (sent as a double).
  * @param q Source quantity.
  * @return JSON object string with value/unit_id fields.
  */
-template <typename UnitTag> std::string to_json(const Quantity<UnitTag> &q) {
-  qtty_quantity_t src{};
-  int32_t status = qtty_quantity_make(q.value(), UnitTraits<UnitTag>::unit_id(), &src);
-  check_status(static_cast<QttyStatus>(status), "Creating source quantity for to_json");
-
-  char *out = nullptr;
-  status = qtty_quantity_to_json(src, &out);
-  check_status(static_cast<QttyStatus>(status), "Serializing quantity to JSON");
-  return from_owned_c(out);
+template <typename UnitTag, typename Rep> std::string to_json(const Quantity<UnitTag, Rep> &q) {
+  Result<std::string> json = try_to_json(q);
+  check_status(json.status(), "Serializing quantity to JSON");
+  return std::move(*json);
 }
 
 inline UnitId unit_id_from_u32(uint32_t raw) {
@@ -111,29 +904,196 @@ inline UnitId unit_id_from_u32(uint32_t raw) {
 }
 
 // Parse {"value":<f64>, "unit_id":<u32>} and construct a typed quantity.
-// Rejects mismatched dimensions and unknown unit_ids at the Rust boundary.
+// Rejects mismatched dimensions and unknown unit_ids (through the cached
+// conversion factor, or at the Rust boundary for non-canonical input).
 
 /**
- * @brief Deserialize a JSON quantity object into a requested target type.
- * @tparam T Unit tag or Quantity type of the target.
- * @param json JSON input string view.
- * @return Quantity converted to requested target unit.
+ * @brief Deserialize a JSON quantity object into a target type, without throwing.
+ * @tparam T Unit tag or Quantity type of the target; a Quantity type also
+ *           selects the representation (double for bare tags).
+ * @param json JSON text; need not be NUL-terminated.
+ * @return Quantity converted to requested target unit, or the failing status.
  */
-template <typename T> Quantity<typename ExtractTag<T>::type> from_json(std::string_view json) {
+template <typename T>
+Result<quantity_type_t<T>> try_from_json(std::string_view json) noexcept {
   using UnitTag = typename ExtractTag<T>::type;
+  using Target = quantity_type_t<T>;
+#if QTTY_HAS_NATIVE_JSON
+  double value = 0.0;
+  UnitId unit{};
+  if (detail::parse_json_object(json, value, unit)) {
+#if QTTY_JSON_VERIFY
+    const QttyStatus checked = detail::verify_json_input(json, value, unit, true);
+    if (checked != QTTY_STATUS_OK) {
+      return Result<Target>::from_status(checked);
+    }
+#endif
+    if (unit != UnitTraits<UnitTag>::unit_id()) {
+      Result<double> converted = try_convert_value(value, unit, UnitTraits<UnitTag>::unit_id());
+      if (!converted) {
+        return Result<Target>::from_status(converted.status());
+      }
+      value = *converted;
+    }
+    return Target(detail::to_rep<typename Target::rep>(value));
+  }
+#endif
+  const detail::NulTerminated text(json);
+  if (!text.c_str()) {
+    return Result<Target>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
   qtty_quantity_t out_qty{};
-  int32_t status = qtty_quantity_from_json(json.data(), &out_qty);
-  check_status(static_cast<QttyStatus>(status), "Deserializing quantity from JSON");
+  int32_t status = qtty_quantity_from_json(text.c_str(), &out_qty);
+  if (status != QTTY_STATUS_OK) {
+    return Result<Target>::from_status(static_cast<QttyStatus>(status));
+  }
 
   // Convert to requested UnitTag if needed; Rust returns the unit in JSON
   if (out_qty.unit != UnitTraits<UnitTag>::unit_id()) {
     qtty_quantity_t conv{};
     status = qtty_quantity_convert(out_qty, UnitTraits<UnitTag>::unit_id(), &conv);
-    check_status(static_cast<QttyStatus>(status),
-                 "Converting deserialized quantity to target unit");
-    return Quantity<UnitTag>(conv.value);
+    if (status != QTTY_STATUS_OK) {
+      return Result<Target>::from_status(static_cast<QttyStatus>(status));
+    }
+    return Target(detail::to_rep<typename Target::rep>(conv.value));
+  }
+  return Target(detail::to_rep<typename Target::rep>(out_qty.value));
+}
+
+/**
+ * @brief Deserialize a JSON quantity object into a requested target type.
+ * @tparam T Unit tag or Quantity type of the target; a Quantity type also
+ *           selects the representation (double for bare tags).
+ * @param json JSON text; need not be NUL-terminated.
+ * @return Quantity converted to requested target unit.
+ */
+template <typename T> quantity_type_t<T> from_json(std::string_view json) {
+  auto result = try_from_json<T>(json);
+  check_status(result.status(), "Deserializing quantity from JSON");
+  return *result;
+}
+
+/// try_from_json() of the @p length characters at @p json, e.g. a field inside
+/// a larger receive buffer; no NUL terminator is needed.
+template <typename T>
+Result<quantity_type_t<T>> try_from_json(const char *json, std::size_t length) noexcept {
+  return try_from_json<T>(std::string_view(json, length));
+}
+
+/// from_json() of the @p length characters at @p json.
+template <typename T> quantity_type_t<T> from_json(const char *json, std::size_t length) {
+  return from_json<T>(std::string_view(json, length));
+}
+
+// ============================================================================
+// JSON Arrays
+// ============================================================================
+// Columnar form {"unit_id":<u32>,"values":[<f64>,...]}: the unit is written
+// once, each value in the notation of to_json_value().
+
+/**
+ * @brief Append the columnar JSON of @p values to @p out.
+ *
+ * @p out is a growable character buffer with `size()`, `resize()` and
+ * `data()` (`std::string`, `std::vector<char>`); it is grown once for the
+ * longest possible text and trimmed afterwards.
+ * @throws QttyException only when QTTY_HAS_NATIVE_JSON is 0 and qtty-ffi fails.
+ */
+template <typename UnitTag, typename Rep, typename Buffer>
+void to_json_array(QuantitySpan<UnitTag, Rep> values, Buffer &out) {
+  const UnitId unit = UnitTraits<UnitTag>::unit_id();
+  const std::size_t start = out.size();
+  out.resize(start + 32 + values.size() * (kMaxJsonValueSize + 1) + 2);
+  char *p = out.data() + start;
+  std::memcpy(p, "{\"unit_id\":", 11);
+  p = std::to_chars(p + 11, p + 21, static_cast<std::uint32_t>(unit)).ptr;
+  std::memcpy(p, ",\"values\":[", 11);
+  p += 11;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (i != 0) {
+      *p++ = ',';
+    }
+    const double value = static_cast<double>(values[i].value());
+#if QTTY_HAS_NATIVE_JSON
+    char *end = detail::write_json_number(p, value);
+#if QTTY_JSON_VERIFY
+    detail::verify_json_output({p, static_cast<std::size_t>(end - p)}, value, unit, false);
+#endif
+    p = end;
+#else
+    const Result<FfiString> json = detail::ffi_to_json(value, unit, false);
+    check_status(json.status(), "Serializing value to JSON");
+    std::memcpy(p, json->data(), json->size());
+    p += json->size();
+#endif
+  }
+  *p++ = ']';
+  *p++ = '}';
+  out.resize(static_cast<std::size_t>(p - out.data()));
+}
+
+/// Columnar JSON of @p values as a new string.
+template <typename UnitTag, typename Rep>
+std::string to_json_array(QuantitySpan<UnitTag, Rep> values) {
+  std::string out;
+  to_json_array(values, out);
+  return out;
+}
+
+/**
+ * @brief Parse a JSON array of quantities into a QuantityArray, without throwing.
+ *
+ * Accepts the columnar form of to_json_array(), a plain array of numbers
+ * (taken in the target unit), or an array of `{"value","unit_id"}` objects
+ * whose units may differ. Values are converted to the target unit in bulk,
+ * one pass per run of equal units.
+ * @tparam T Unit tag or Quantity type of the elements.
+ * @param json JSON text; need not be NUL-terminated.
+ * @return The elements in the target unit, or the failing status (malformed
+ *         JSON, unknown unit, incompatible dimensions).
+ */
+template <typename T> Result<quantity_array_t<T>> try_from_json_array(std::string_view json) {
+  using Array = quantity_array_t<T>;
+  using Rep = typename Array::rep;
+  std::vector<double> values;
+  values.reserve(json.size() / 8);
+  const QttyStatus status = detail::read_json_array(
+      json, UnitTraits<typename Array::unit_tag>::unit_id(), values);
+  if (status != QTTY_STATUS_OK) {
+    return Result<Array>::from_status(status);
+  }
+  if constexpr (std::is_same_v<Rep, double>) {
+    return Array(values.data(), values.size());
+  } else {
+    Array out(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      out.data()[i] = detail::to_rep<Rep>(values[i]);
+    }
+    return out;
   }
-  return Quantity<UnitTag>(out_qty.value);
+}
+
+/**
+ * @brief Parse a JSON array of quantities into a QuantityArray.
+ * @see try_from_json_array()
+ * @throws QttyException and derived exception types on failure.
+ */
+template <typename T> quantity_array_t<T> from_json_array(std::string_view json) {
+  auto result = try_from_json_array<T>(json);
+  check_status(result.status(), "Deserializing quantity array from JSON");
+  return std::move(*result);
+}
+
+/// try_from_json_array() of the @p length characters at @p json.
+template <typename T>
+Result<quantity_array_t<T>> try_from_json_array(const char *json, std::size_t length) {
+  return try_from_json_array<T>(std::string_view(json, length));
+}
+
+/// from_json_array() of the @p length characters at @p json.
+template <typename T>
+quantity_array_t<T> from_json_array(const char *json, std::size_t length) {
+  return from_json_array<T>(std::string_view(json, length));
 }
 
 } // namespace serialization
@@ -146,36 +1106,88 @@ template <typename T> Quantity<typename ExtractTag<T>::type> from_json(std::stri
 namespace derived_serialization {
 
 /**
- * @brief Serialize a compound quantity as JSON.
+ * @brief Serialize a compound quantity as JSON into the qtty-ffi buffer,
+ *        without throwing or copying.
  * @tparam Tag CompoundTag type of the quantity.
  * @param q Source compound quantity.
- * @return JSON string.
+ * @return JSON text owned by an FfiString, or the failing status.
  */
-template <typename Tag> std::string to_json(const Quantity<Tag> &q) {
+template <typename Tag, typename Rep>
+Result<FfiString> try_to_ffi_json(const Quantity<Tag, Rep> &q) noexcept {
   static_assert(is_compound_v<Tag>, "derived_serialization::to_json requires a compound quantity");
   qtty_derived_quantity_t src{};
-  int32_t status = qtty_derived_make(q.value(), UnitTraits<Tag>::numerator_unit_id(),
-                                     UnitTraits<Tag>::denominator_unit_id(), &src);
-  check_status(static_cast<QttyStatus>(status), "Creating derived quantity for serialization");
+  int32_t status =
+      qtty_derived_make(static_cast<double>(q.value()), UnitTraits<Tag>::numerator_unit_id(),
+                        UnitTraits<Tag>::denominator_unit_id(), &src);
+  if (status != QTTY_STATUS_OK) {
+    return Result<FfiString>::from_status(static_cast<QttyStatus>(status));
+  }
 
   char *out = nullptr;
   status = qtty_derived_to_json(src, &out);
-  check_status(static_cast<QttyStatus>(status), "Serializing derived quantity to JSON");
-  return serialization::from_owned_c(out);
+  FfiString json(out);
+  if (status != QTTY_STATUS_OK) {
+    return Result<FfiString>::from_status(static_cast<QttyStatus>(status));
+  }
+  return json;
 }
 
 /**
- * @brief Deserialize a JSON string into a compound quantity.
+ * @brief Serialize a compound quantity as JSON into the qtty-ffi buffer.
+ * @tparam Tag CompoundTag type of the quantity.
+ * @param q Source compound quantity.
+ * @return JSON text owned by an FfiString.
+ */
+template <typename Tag, typename Rep> FfiString to_ffi_json(const Quantity<Tag, Rep> &q) {
+  Result<FfiString> json = try_to_ffi_json(q);
+  check_status(json.status(), "Serializing derived quantity to JSON");
+  return std::move(*json);
+}
+
+/**
+ * @brief Serialize a compound quantity as JSON, without throwing.
+ * @tparam Tag CompoundTag type of the quantity.
+ * @param q Source compound quantity.
+ * @return JSON string, or the failing status.
+ */
+template <typename Tag, typename Rep>
+Result<std::string> try_to_json(const Quantity<Tag, Rep> &q) {
+  return detail::to_std_string(try_to_ffi_json(q));
+}
+
+/**
+ * @brief Serialize a compound quantity as JSON.
+ * @tparam Tag CompoundTag type of the quantity.
+ * @param q Source compound quantity.
+ * @return JSON string.
+ */
+template <typename Tag, typename Rep> std::string to_json(const Quantity<Tag, Rep> &q) {
+  Result<std::string> json = try_to_json(q);
+  check_status(json.status(), "Serializing derived quantity to JSON");
+  return std::move(*json);
+}
+
+/**
+ * @brief Deserialize a JSON string into a compound quantity, without throwing.
  * @tparam T CompoundTag or Quantity<CompoundTag> type.
- * @param json JSON input string view.
- * @return Deserialized compound quantity, converted to requested target units.
+ * @param json JSON text; need not be NUL-terminated.
+ * @return Deserialized compound quantity in the requested units, or the
+ *         failing status.
  */
-template <typename T> Quantity<typename ExtractTag<T>::type> from_json(std::string_view json) {
+template <typename T>
+Result<quantity_type_t<T>> try_from_json(std::string_view json) noexcept {
   using Tag = typename ExtractTag<T>::type;
+  using Target = quantity_type_t<T>;
   static_assert(is_compound_v<Tag>, "derived_serialization::from_json requires a compound type");
+  const detail::NulTerminated text(json);
+  if (!text.c_str()) {
+    return Result<Target>::from_status(QTTY_STATUS_BUFFER_TOO_SMALL);
+  }
   qtty_derived_quantity_t out_qty{};
-  int32_t status = qtty_derived_from_json(json.data(), &out_qty);
-  check_status(static_cast<QttyStatus>(status), "Deserializing derived quantity from JSON");
+  int32_t status = qtty_derived_from_json(text.c_str(), &out_qty);
+  if (status != QTTY_STATUS_OK) {
+    return Result<Target>::from_status(static_cast<QttyStatus>(status));
+  }
 
   // Convert to requested units if needed
   if (out_qty.numerator != UnitTraits<Tag>::numerator_unit_id() ||
@@ -183,10 +1195,35 @@ template <typename T> Quantity<typename ExtractTag<T>::type> from_json(std::stri
     qtty_derived_quantity_t conv{};
     status = qtty_derived_convert(out_qty, UnitTraits<Tag>::numerator_unit_id(),
                                   UnitTraits<Tag>::denominator_unit_id(), &conv);
-    check_status(static_cast<QttyStatus>(status), "Converting deserialized derived quantity");
-    return Quantity<Tag>(conv.value);
+    if (status != QTTY_STATUS_OK) {
+      return Result<Target>::from_status(static_cast<QttyStatus>(status));
+    }
+    return Target(detail::to_rep<typename Target::rep>(conv.value));
   }
-  return Quantity<Tag>(out_qty.value);
+  return Target(detail::to_rep<typename Target::rep>(out_qty.value));
+}
+
+/**
+ * @brief Deserialize a JSON string into a compound quantity.
+ * @tparam T CompoundTag or Quantity<CompoundTag> type.
+ * @param json JSON text; need not be NUL-terminated.
+ * @return Deserialized compound quantity, converted to requested target units.
+ */
+template <typename T> quantity_type_t<T> from_json(std::string_view json) {
+  auto result = try_from_json<T>(json);
+  check_status(result.status(), "Deserializing derived quantity from JSON");
+  return *result;
+}
+
+/// try_from_json() of the @p length characters at @p json.
+template <typename T>
+Result<quantity_type_t<T>> try_from_json(const char *json, std::size_t length) noexcept {
+  return try_from_json<T>(std::string_view(json, length));
+}
+
+/// from_json() of the @p length characters at @p json.
+template <typename T> quantity_type_t<T> from_json(const char *json, std::size_t length) {
+  return from_json<T>(std::string_view(json, length));
 }
 
 } // namespace derived_serialization
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file dispatch.hpp
+ * @brief Runtime CPU-feature dispatch for the bulk conversion kernels.
+ *
+ * The best instruction set supported by the running CPU (and enabled by the
+ * OS) is detected once, on first use, and the matching kernels are stored in
+ * a function-pointer table. Subsequent calls go through that table with no
+ * further feature checks.
+ *
+ * @code
+ * std::vector<double> km = {...};
+ * std::vector<double> m(km.size());
+ * qtty::simd::scale(km.data(), m.data(), km.size(), 1e3);
+ * @endcode
+ *
+ * Define `QTTY_SIMD_DISABLE` before including any qtty header to compile only
+ * the scalar kernels.
+ */
+
+#include "kernels.hpp"
+
+#include <cstddef>
+
+#if QTTY_SIMD_X86 && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace qtty {
+namespace simd {
+
+/**
+ * @brief Instruction-set tiers with a dedicated kernel implementation.
+ *
+ * Ordered from least to most capable, so levels compare with `<`.
+ */
+enum class SimdLevel { Scalar = 0, SSE2 = 1, AVX2 = 2, AVX512 = 3 };
+
+/// Human-readable name of a SimdLevel (e.g. "avx2").
+inline const char *to_string(SimdLevel level) noexcept {
+  switch (level) {
+  case SimdLevel::SSE2:
+    return "sse2";
+  case SimdLevel::AVX2:
+    return "avx2";
+  case SimdLevel::AVX512:
+    return "avx512";
+  case SimdLevel::Scalar:
+  default:
+    return "scalar";
+  }
+}
+
+/**
+ * @brief Query the CPU for the best supported SimdLevel.
+ *
+ * Performs the CPUID (and XGETBV) checks on every call; use active_level()
+ * for the cached result.
+ */
+inline SimdLevel detect_level() noexcept {
+#if QTTY_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdLevel::AVX512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdLevel::AVX2;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return SimdLevel::SSE2;
+  }
+  return SimdLevel::Scalar;
+#elif QTTY_SIMD_X86 && defined(_MSC_VER)
+  int regs[4] = {0, 0, 0, 0};
+  __cpuid(regs, 0);
+  const int max_leaf = regs[0];
+  __cpuid(regs, 1);
+  const bool sse2 = (regs[3] & (1 << 26)) != 0;
+  const bool osxsave = (regs[2] & (1 << 27)) != 0;
+  const bool avx = (regs[2] & (1 << 28)) != 0;
+  if (!sse2) {
+    return SimdLevel::Scalar;
+  }
+  if (!osxsave || !avx || max_leaf < 7) {
+    return SimdLevel::SSE2;
+  }
+  const unsigned long long xcr0 = _xgetbv(0);
+  const bool ymm_state = (xcr0 & 0x6) == 0x6;
+  const bool zmm_state = (xcr0 & 0xe6) == 0xe6;
+  __cpuidex(regs, 7, 0);
+  const bool avx2 = (regs[1] & (1 << 5)) != 0;
+  const bool avx512f = (regs[1] & (1 << 16)) != 0;
+  if (avx512f && zmm_state) {
+    return SimdLevel::AVX512;
+  }
+  if (avx2 && ymm_state) {
+    return SimdLevel::AVX2;
+  }
+  return SimdLevel::SSE2;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+/**
+ * @brief Function pointers for one instruction-set tier.
+ */
+struct KernelTable {
+  SimdLevel level;
+  void (*scale_f64)(const double *, double *, std::size_t, double) noexcept;
+  void (*scale_f32)(const float *, float *, std::size_t, float) noexcept;
+  void (*affine_f64)(const double *, double *, std::size_t, double, double) noexcept;
+  void (*affine_f32)(const float *, float *, std::size_t, float, float) noexcept;
+};
+
+/**
+ * @brief Kernel table for @p level.
+ *
+ * The caller is responsible for @p level being supported by the running CPU
+ * (i.e. not above detect_level()). Levels without an implementation on the
+ * current target fall back to the scalar kernels.
+ */
+inline KernelTable kernel_table(SimdLevel level) noexcept {
+#if QTTY_SIMD_X86
+  switch (level) {
+  case SimdLevel::AVX512:
+    return {SimdLevel::AVX512, &kernels::scale_f64_avx512, &kernels::scale_f32_avx512,
+            &kernels::affine_f64_avx512, &kernels::affine_f32_avx512};
+  case SimdLevel::AVX2:
+    return {SimdLevel::AVX2, &kernels::scale_f64_avx2, &kernels::scale_f32_avx2,
+            &kernels::affine_f64_avx2, &kernels::affine_f32_avx2};
+  case SimdLevel::SSE2:
+    return {SimdLevel::SSE2, &kernels::scale_f64_sse2, &kernels::scale_f32_sse2,
+            &kernels::affine_f64_sse2, &kernels::affine_f32_sse2};
+  case SimdLevel::Scalar:
+  default:
+    break;
+  }
+#else
+  (void)level;
+#endif
+  return {SimdLevel::Scalar, &kernels::scale_f64_scalar, &kernels::scale_f32_scalar,
+          &kernels::affine_f64_scalar, &kernels::affine_f32_scalar};
+}
+
+/**
+ * @brief The kernel table selected for this process.
+ *
+ * Resolved on first use and never changed afterwards; initialization is
+ * thread-safe.
+ */
+inline const KernelTable &active_kernels() noexcept {
+  static const KernelTable table = kernel_table(detect_level());
+  return table;
+}
+
+/// The instruction-set tier used by the dispatched kernels.
+inline SimdLevel active_level() noexcept { return active_kernels().level; }
+
+// ============================================================================
+// Dispatched Entry Points
+// ============================================================================
+// `in` and `out` may be the same buffer; partially overlapping ranges are not
+// supported.
+
+/// `out[i] = in[i] * factor` for `count` doubles.
+inline void scale(const double *in, double *out, std::size_t count, double factor) noexcept {
+  active_kernels().scale_f64(in, out, count, factor);
+}
+
+/// `out[i] = in[i] * factor` for `count` floats.
+inline void scale(const float *in, float *out, std::size_t count, float factor) noexcept {
+  active_kernels().scale_f32(in, out, count, factor);
+}
+
+/// `out[i] = in[i] * factor + offset` for `count` doubles.
+inline void affine(const double *in, double *out, std::size_t count, double factor,
+                   double offset) noexcept {
+  active_kernels().affine_f64(in, out, count, factor, offset);
+}
+
+/// `out[i] = in[i] * factor + offset` for `count` floats.
+inline void affine(const float *in, float *out, std::size_t count, float factor,
+                   float offset) noexcept {
+  active_kernels().affine_f32(in, out, count, factor, offset);
+}
+
+} // namespace simd
+} // namespace qtty
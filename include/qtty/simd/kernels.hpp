@@ -0,0 +1,317 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file kernels.hpp
+ * @brief Scalar and x86 SIMD kernels for bulk linear and affine conversion.
+ *
+ * Every kernel computes `out[i] = in[i] * scale` (scale kernels) or
+ * `out[i] = in[i] * scale + offset` (affine kernels) for `count` elements.
+ * The multiply and the add are rounded separately (floating-point contraction
+ * into FMA is disabled for these kernels), so every instruction-set variant
+ * produces bit-identical results to the scalar kernel.
+ *
+ * The vector kernels peel a scalar head until the output pointer reaches the
+ * vector alignment, run aligned stores with unaligned loads over the body,
+ * and finish the remainder with a scalar tail. `in` and `out` may be the same
+ * buffer; partially overlapping ranges are not supported.
+ *
+ * The x86 kernels are compiled with per-function target attributes, so no
+ * global `-mavx2` / `-mavx512f` flags are needed. They must only be called
+ * on CPUs that support the instruction set; use the dispatcher in
+ * `qtty/simd/dispatch.hpp` rather than calling them directly.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(QTTY_SIMD_DISABLE) &&                                                              \
+    (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#define QTTY_SIMD_X86 1
+#else
+#define QTTY_SIMD_X86 0
+#endif
+
+#if QTTY_SIMD_X86
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define QTTY_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+// MSVC accepts every intrinsic without per-function target flags.
+#define QTTY_SIMD_TARGET(isa)
+#endif
+#endif
+
+// GCC contracts `a * b + c` into an FMA by default in C++ whenever the target
+// has one (e.g. inside the AVX-512 kernels), which would make results depend
+// on the dispatched tier.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace qtty {
+namespace simd {
+namespace kernels {
+
+// ============================================================================
+// Scalar Reference Kernels
+// ============================================================================
+
+inline void scale_f64_scalar(const double *in, double *out, std::size_t count,
+                             double scale) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    out[i] = in[i] * scale;
+  }
+}
+
+inline void scale_f32_scalar(const float *in, float *out, std::size_t count,
+                             float scale) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    out[i] = in[i] * scale;
+  }
+}
+
+inline void affine_f64_scalar(const double *in, double *out, std::size_t count, double scale,
+                              double offset) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    const double scaled = in[i] * scale;
+    out[i] = scaled + offset;
+  }
+}
+
+inline void affine_f32_scalar(const float *in, float *out, std::size_t count, float scale,
+                              float offset) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    const float scaled = in[i] * scale;
+    out[i] = scaled + offset;
+  }
+}
+
+#if QTTY_SIMD_X86
+
+namespace detail {
+
+/// Number of leading elements to process one at a time before @p out is
+/// aligned to @p alignment bytes (clamped to @p count).
+template <typename T>
+inline std::size_t head_length(const T *out, std::size_t count, std::size_t alignment) noexcept {
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(out);
+  if (address % sizeof(T) != 0) {
+    // Not even element-aligned: the vector body can never align.
+    return count;
+  }
+  const std::size_t misalignment = address % alignment;
+  const std::size_t head = misalignment == 0 ? 0 : (alignment - misalignment) / sizeof(T);
+  return head < count ? head : count;
+}
+
+} // namespace detail
+
+// ============================================================================
+// SSE2 Kernels (128-bit)
+// ============================================================================
+
+QTTY_SIMD_TARGET("sse2")
+inline void scale_f64_sse2(const double *in, double *out, std::size_t count,
+                           double scale) noexcept {
+  std::size_t i = detail::head_length(out, count, 16);
+  scale_f64_scalar(in, out, i, scale);
+  const __m128d factor = _mm_set1_pd(scale);
+  for (; i + 4 <= count; i += 4) {
+    const __m128d a = _mm_loadu_pd(in + i);
+    const __m128d b = _mm_loadu_pd(in + i + 2);
+    _mm_store_pd(out + i, _mm_mul_pd(a, factor));
+    _mm_store_pd(out + i + 2, _mm_mul_pd(b, factor));
+  }
+  scale_f64_scalar(in + i, out + i, count - i, scale);
+}
+
+QTTY_SIMD_TARGET("sse2")
+inline void scale_f32_sse2(const float *in, float *out, std::size_t count, float scale) noexcept {
+  std::size_t i = detail::head_length(out, count, 16);
+  scale_f32_scalar(in, out, i, scale);
+  const __m128 factor = _mm_set1_ps(scale);
+  for (; i + 8 <= count; i += 8) {
+    const __m128 a = _mm_loadu_ps(in + i);
+    const __m128 b = _mm_loadu_ps(in + i + 4);
+    _mm_store_ps(out + i, _mm_mul_ps(a, factor));
+    _mm_store_ps(out + i + 4, _mm_mul_ps(b, factor));
+  }
+  scale_f32_scalar(in + i, out + i, count - i, scale);
+}
+
+QTTY_SIMD_TARGET("sse2")
+inline void affine_f64_sse2(const double *in, double *out, std::size_t count, double scale,
+                            double offset) noexcept {
+  std::size_t i = detail::head_length(out, count, 16);
+  affine_f64_scalar(in, out, i, scale, offset);
+  const __m128d factor = _mm_set1_pd(scale);
+  const __m128d shift = _mm_set1_pd(offset);
+  for (; i + 4 <= count; i += 4) {
+    const __m128d a = _mm_loadu_pd(in + i);
+    const __m128d b = _mm_loadu_pd(in + i + 2);
+    _mm_store_pd(out + i, _mm_add_pd(_mm_mul_pd(a, factor), shift));
+    _mm_store_pd(out + i + 2, _mm_add_pd(_mm_mul_pd(b, factor), shift));
+  }
+  affine_f64_scalar(in + i, out + i, count - i, scale, offset);
+}
+
+QTTY_SIMD_TARGET("sse2")
+inline void affine_f32_sse2(const float *in, float *out, std::size_t count, float scale,
+                            float offset) noexcept {
+  std::size_t i = detail::head_length(out, count, 16);
+  affine_f32_scalar(in, out, i, scale, offset);
+  const __m128 factor = _mm_set1_ps(scale);
+  const __m128 shift = _mm_set1_ps(offset);
+  for (; i + 8 <= count; i += 8) {
+    const __m128 a = _mm_loadu_ps(in + i);
+    const __m128 b = _mm_loadu_ps(in + i + 4);
+    _mm_store_ps(out + i, _mm_add_ps(_mm_mul_ps(a, factor), shift));
+    _mm_store_ps(out + i + 4, _mm_add_ps(_mm_mul_ps(b, factor), shift));
+  }
+  affine_f32_scalar(in + i, out + i, count - i, scale, offset);
+}
+
+// ============================================================================
+// AVX2 Kernels (256-bit)
+// ============================================================================
+
+QTTY_SIMD_TARGET("avx2")
+inline void scale_f64_avx2(const double *in, double *out, std::size_t count,
+                           double scale) noexcept {
+  std::size_t i = detail::head_length(out, count, 32);
+  scale_f64_scalar(in, out, i, scale);
+  const __m256d factor = _mm256_set1_pd(scale);
+  for (; i + 8 <= count; i += 8) {
+    const __m256d a = _mm256_loadu_pd(in + i);
+    const __m256d b = _mm256_loadu_pd(in + i + 4);
+    _mm256_store_pd(out + i, _mm256_mul_pd(a, factor));
+    _mm256_store_pd(out + i + 4, _mm256_mul_pd(b, factor));
+  }
+  scale_f64_scalar(in + i, out + i, count - i, scale);
+}
+
+QTTY_SIMD_TARGET("avx2")
+inline void scale_f32_avx2(const float *in, float *out, std::size_t count, float scale) noexcept {
+  std::size_t i = detail::head_length(out, count, 32);
+  scale_f32_scalar(in, out, i, scale);
+  const __m256 factor = _mm256_set1_ps(scale);
+  for (; i + 16 <= count; i += 16) {
+    const __m256 a = _mm256_loadu_ps(in + i);
+    const __m256 b = _mm256_loadu_ps(in + i + 8);
+    _mm256_store_ps(out + i, _mm256_mul_ps(a, factor));
+    _mm256_store_ps(out + i + 8, _mm256_mul_ps(b, factor));
+  }
+  scale_f32_scalar(in + i, out + i, count - i, scale);
+}
+
+QTTY_SIMD_TARGET("avx2")
+inline void affine_f64_avx2(const double *in, double *out, std::size_t count, double scale,
+                            double offset) noexcept {
+  std::size_t i = detail::head_length(out, count, 32);
+  affine_f64_scalar(in, out, i, scale, offset);
+  const __m256d factor = _mm256_set1_pd(scale);
+  const __m256d shift = _mm256_set1_pd(offset);
+  for (; i + 8 <= count; i += 8) {
+    const __m256d a = _mm256_loadu_pd(in + i);
+    const __m256d b = _mm256_loadu_pd(in + i + 4);
+    _mm256_store_pd(out + i, _mm256_add_pd(_mm256_mul_pd(a, factor), shift));
+    _mm256_store_pd(out + i + 4, _mm256_add_pd(_mm256_mul_pd(b, factor), shift));
+  }
+  affine_f64_scalar(in + i, out + i, count - i, scale, offset);
+}
+
+QTTY_SIMD_TARGET("avx2")
+inline void affine_f32_avx2(const float *in, float *out, std::size_t count, float scale,
+                            float offset) noexcept {
+  std::size_t i = detail::head_length(out, count, 32);
+  affine_f32_scalar(in, out, i, scale, offset);
+  const __m256 factor = _mm256_set1_ps(scale);
+  const __m256 shift = _mm256_set1_ps(offset);
+  for (; i + 16 <= count; i += 16) {
+    const __m256 a = _mm256_loadu_ps(in + i);
+    const __m256 b = _mm256_loadu_ps(in + i + 8);
+    _mm256_store_ps(out + i, _mm256_add_ps(_mm256_mul_ps(a, factor), shift));
+    _mm256_store_ps(out + i + 8, _mm256_add_ps(_mm256_mul_ps(b, factor), shift));
+  }
+  affine_f32_scalar(in + i, out + i, count - i, scale, offset);
+}
+
+// ============================================================================
+// AVX-512 Kernels (512-bit)
+// ============================================================================
+
+QTTY_SIMD_TARGET("avx512f")
+inline void scale_f64_avx512(const double *in, double *out, std::size_t count,
+                             double scale) noexcept {
+  std::size_t i = detail::head_length(out, count, 64);
+  scale_f64_scalar(in, out, i, scale);
+  const __m512d factor = _mm512_set1_pd(scale);
+  for (; i + 16 <= count; i += 16) {
+    const __m512d a = _mm512_loadu_pd(in + i);
+    const __m512d b = _mm512_loadu_pd(in + i + 8);
+    _mm512_store_pd(out + i, _mm512_mul_pd(a, factor));
+    _mm512_store_pd(out + i + 8, _mm512_mul_pd(b, factor));
+  }
+  scale_f64_scalar(in + i, out + i, count - i, scale);
+}
+
+QTTY_SIMD_TARGET("avx512f")
+inline void scale_f32_avx512(const float *in, float *out, std::size_t count,
+                             float scale) noexcept {
+  std::size_t i = detail::head_length(out, count, 64);
+  scale_f32_scalar(in, out, i, scale);
+  const __m512 factor = _mm512_set1_ps(scale);
+  for (; i + 32 <= count; i += 32) {
+    const __m512 a = _mm512_loadu_ps(in + i);
+    const __m512 b = _mm512_loadu_ps(in + i + 16);
+    _mm512_store_ps(out + i, _mm512_mul_ps(a, factor));
+    _mm512_store_ps(out + i + 16, _mm512_mul_ps(b, factor));
+  }
+  scale_f32_scalar(in + i, out + i, count - i, scale);
+}
+
+QTTY_SIMD_TARGET("avx512f")
+inline void affine_f64_avx512(const double *in, double *out, std::size_t count, double scale,
+                              double offset) noexcept {
+  std::size_t i = detail::head_length(out, count, 64);
+  affine_f64_scalar(in, out, i, scale, offset);
+  const __m512d factor = _mm512_set1_pd(scale);
+  const __m512d shift = _mm512_set1_pd(offset);
+  for (; i + 16 <= count; i += 16) {
+    const __m512d a = _mm512_loadu_pd(in + i);
+    const __m512d b = _mm512_loadu_pd(in + i + 8);
+    _mm512_store_pd(out + i, _mm512_add_pd(_mm512_mul_pd(a, factor), shift));
+    _mm512_store_pd(out + i + 8, _mm512_add_pd(_mm512_mul_pd(b, factor), shift));
+  }
+  affine_f64_scalar(in + i, out + i, count - i, scale, offset);
+}
+
+QTTY_SIMD_TARGET("avx512f")
+inline void affine_f32_avx512(const float *in, float *out, std::size_t count, float scale,
+                              float offset) noexcept {
+  std::size_t i = detail::head_length(out, count, 64);
+  affine_f32_scalar(in, out, i, scale, offset);
+  const __m512 factor = _mm512_set1_ps(scale);
+  const __m512 shift = _mm512_set1_ps(offset);
+  for (; i + 32 <= count; i += 32) {
+    const __m512 a = _mm512_loadu_ps(in + i);
+    const __m512 b = _mm512_loadu_ps(in + i + 16);
+    _mm512_store_ps(out + i, _mm512_add_ps(_mm512_mul_ps(a, factor), shift));
+    _mm512_store_ps(out + i + 16, _mm512_add_ps(_mm512_mul_ps(b, factor), shift));
+  }
+  affine_f32_scalar(in + i, out + i, count - i, scale, offset);
+}
+
+#endif // QTTY_SIMD_X86
+
+} // namespace kernels
+} // namespace simd
+} // namespace qtty
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC pop_options
+#endif
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -11,12 +12,16 @@ struct MeterPerSecondSquaredTag {};
 struct StandardGravityTag {};
 
 template <> struct UnitTraits<MeterPerSecondSquaredTag> {
+  using dimension = dim::Acceleration;
   static constexpr UnitId unit_id() { return UNIT_ID_METER_PER_SECOND_SQUARED; }
   static constexpr std::string_view symbol() { return "m/s²"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<StandardGravityTag> {
+  using dimension = dim::Acceleration;
   static constexpr UnitId unit_id() { return UNIT_ID_STANDARD_GRAVITY; }
   static constexpr std::string_view symbol() { return "g₀"; }
+  static constexpr double to_si_factor() { return 9.80665e0; }
 };
 
 using MeterPerSecondSquared = Quantity<MeterPerSecondSquaredTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -14,24 +15,34 @@ struct MillimoleTag {};
 struct KilomoleTag {};
 
 template <> struct UnitTraits<MoleTag> {
+  using dimension = dim::AmountOfSubstance;
   static constexpr UnitId unit_id() { return UNIT_ID_MOLE; }
   static constexpr std::string_view symbol() { return "mol"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<NanomoleTag> {
+  using dimension = dim::AmountOfSubstance;
   static constexpr UnitId unit_id() { return UNIT_ID_NANOMOLE; }
   static constexpr std::string_view symbol() { return "nmol"; }
+  static constexpr double to_si_factor() { return 1e-9; }
 };
 template <> struct UnitTraits<MicromoleTag> {
+  using dimension = dim::AmountOfSubstance;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROMOLE; }
   static constexpr std::string_view symbol() { return "µmol"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MillimoleTag> {
+  using dimension = dim::AmountOfSubstance;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIMOLE; }
   static constexpr std::string_view symbol() { return "mmol"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KilomoleTag> {
+  using dimension = dim::AmountOfSubstance;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOMOLE; }
   static constexpr std::string_view symbol() { return "kmol"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 
 using Mole = Quantity<MoleTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -19,44 +20,64 @@ struct TurnTag {};
 struct HourAngleTag {};
 
 template <> struct UnitTraits<MilliradianTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIRADIAN; }
   static constexpr std::string_view symbol() { return "mrad"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<RadianTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_RADIAN; }
   static constexpr std::string_view symbol() { return "rad"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MicroArcsecondTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_MICRO_ARCSECOND; }
   static constexpr std::string_view symbol() { return "μas"; }
+  static constexpr double to_si_factor() { return 4.84813681109536e-12; }
 };
 template <> struct UnitTraits<MilliArcsecondTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLI_ARCSECOND; }
   static constexpr std::string_view symbol() { return "mas"; }
+  static constexpr double to_si_factor() { return 4.8481368110953594e-9; }
 };
 template <> struct UnitTraits<ArcsecondTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_ARCSECOND; }
   static constexpr std::string_view symbol() { return "″"; }
+  static constexpr double to_si_factor() { return 4.84813681109536e-6; }
 };
 template <> struct UnitTraits<ArcminuteTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_ARCMINUTE; }
   static constexpr std::string_view symbol() { return "′"; }
+  static constexpr double to_si_factor() { return 2.908882086657216e-4; }
 };
 template <> struct UnitTraits<DegreeTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_DEGREE; }
   static constexpr std::string_view symbol() { return "°"; }
+  static constexpr double to_si_factor() { return 1.7453292519943295e-2; }
 };
 template <> struct UnitTraits<GradianTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_GRADIAN; }
   static constexpr std::string_view symbol() { return "gon"; }
+  static constexpr double to_si_factor() { return 1.5707963267948967e-2; }
 };
 template <> struct UnitTraits<TurnTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_TURN; }
   static constexpr std::string_view symbol() { return "tr"; }
+  static constexpr double to_si_factor() { return 6.283185307179586e0; }
 };
 template <> struct UnitTraits<HourAngleTag> {
+  using dimension = dim::Angle;
   static constexpr UnitId unit_id() { return UNIT_ID_HOUR_ANGLE; }
   static constexpr std::string_view symbol() { return "h"; }
+  static constexpr double to_si_factor() { return 2.617993877991494e-1; }
 };
 
 using Milliradian = Quantity<MilliradianTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -20,48 +21,81 @@ struct SquareMileTag {};
 struct AcreTag {};
 
 template <> struct UnitTraits<SquareMeterTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_METER; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
+  using si_ratio = std::ratio<1, 1>;
 };
 template <> struct UnitTraits<SquareKilometerTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_KILOMETER; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e6; }
+  using si_ratio = std::ratio<1000000, 1>;
 };
 template <> struct UnitTraits<SquareCentimeterTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_CENTIMETER; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e-4; }
+  using si_ratio = std::ratio<1, 10000>;
 };
 template <> struct UnitTraits<SquareMillimeterTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_MILLIMETER; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e-6; }
+  using si_ratio = std::ratio<1, 1000000>;
 };
 template <> struct UnitTraits<HectareTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_HECTARE; }
   static constexpr std::string_view symbol() { return "ha"; }
+  static constexpr double to_si_factor() { return 1e4; }
+  using si_ratio = std::ratio<10000, 1>;
 };
 template <> struct UnitTraits<AreTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_ARE; }
   static constexpr std::string_view symbol() { return "a"; }
+  static constexpr double to_si_factor() { return 1e2; }
+  using si_ratio = std::ratio<100, 1>;
 };
 template <> struct UnitTraits<SquareInchTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_INCH; }
   static constexpr std::string_view symbol() { return "in²"; }
+  static constexpr double to_si_factor() { return 6.4516e-4; }
+  using si_ratio = std::ratio<16129, 25000000>;
 };
 template <> struct UnitTraits<SquareFootTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_FOOT; }
   static constexpr std::string_view symbol() { return "ft²"; }
+  static constexpr double to_si_factor() { return 9.290304e-2; }
+  using si_ratio = std::ratio<145161, 1562500>;
 };
 template <> struct UnitTraits<SquareYardTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_YARD; }
   static constexpr std::string_view symbol() { return "yd²"; }
+  static constexpr double to_si_factor() { return 8.3612736e-1; }
+  using si_ratio = std::ratio<1306449, 1562500>;
 };
 template <> struct UnitTraits<SquareMileTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_MILE; }
   static constexpr std::string_view symbol() { return "mi²"; }
+  static constexpr double to_si_factor() { return 2.589988110336e6; }
+  using si_ratio = std::ratio<40468564224, 15625>;
 };
 template <> struct UnitTraits<AcreTag> {
+  using dimension = dim::Area;
   static constexpr UnitId unit_id() { return UNIT_ID_ACRE; }
   static constexpr std::string_view symbol() { return "ac"; }
+  static constexpr double to_si_factor() { return 4.0468564224e3; }
+  using si_ratio = std::ratio<316160658, 78125>;
 };
 
 using SquareMeter = Quantity<SquareMeterTag>;
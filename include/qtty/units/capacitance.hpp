@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -14,24 +15,34 @@ struct MicrofaradTag {};
 struct MillifaradTag {};
 
 template <> struct UnitTraits<FaradTag> {
+  using dimension = dim::Capacitance;
   static constexpr UnitId unit_id() { return UNIT_ID_FARAD; }
   static constexpr std::string_view symbol() { return "F"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<PicofaradTag> {
+  using dimension = dim::Capacitance;
   static constexpr UnitId unit_id() { return UNIT_ID_PICOFARAD; }
   static constexpr std::string_view symbol() { return "pF"; }
+  static constexpr double to_si_factor() { return 1e-12; }
 };
 template <> struct UnitTraits<NanofaradTag> {
+  using dimension = dim::Capacitance;
   static constexpr UnitId unit_id() { return UNIT_ID_NANOFARAD; }
   static constexpr std::string_view symbol() { return "nF"; }
+  static constexpr double to_si_factor() { return 1e-9; }
 };
 template <> struct UnitTraits<MicrofaradTag> {
+  using dimension = dim::Capacitance;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROFARAD; }
   static constexpr std::string_view symbol() { return "µF"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MillifaradTag> {
+  using dimension = dim::Capacitance;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIFARAD; }
   static constexpr std::string_view symbol() { return "mF"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 
 using Farad = Quantity<FaradTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -13,20 +14,28 @@ struct MicrocoulombTag {};
 struct KilocoulombTag {};
 
 template <> struct UnitTraits<CoulombTag> {
+  using dimension = dim::Charge;
   static constexpr UnitId unit_id() { return UNIT_ID_COULOMB; }
   static constexpr std::string_view symbol() { return "C"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MillicoulombTag> {
+  using dimension = dim::Charge;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLICOULOMB; }
   static constexpr std::string_view symbol() { return "mC"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<MicrocoulombTag> {
+  using dimension = dim::Charge;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROCOULOMB; }
   static constexpr std::string_view symbol() { return "µC"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<KilocoulombTag> {
+  using dimension = dim::Charge;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOCOULOMB; }
   static constexpr std::string_view symbol() { return "kC"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 
 using Coulomb = Quantity<CoulombTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -13,20 +14,28 @@ struct MilliampereTag {};
 struct KiloampereTag {};
 
 template <> struct UnitTraits<AmpereTag> {
+  using dimension = dim::Current;
   static constexpr UnitId unit_id() { return UNIT_ID_AMPERE; }
   static constexpr std::string_view symbol() { return "A"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MicroampereTag> {
+  using dimension = dim::Current;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROAMPERE; }
   static constexpr std::string_view symbol() { return "µA"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MilliampereTag> {
+  using dimension = dim::Current;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIAMPERE; }
   static constexpr std::string_view symbol() { return "mA"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KiloampereTag> {
+  using dimension = dim::Current;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOAMPERE; }
   static constexpr std::string_view symbol() { return "kA"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 
 using Ampere = Quantity<AmpereTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -13,20 +14,28 @@ struct GramPerMilliliterTag {};
 struct PoundPerCubicFootTag {};
 
 template <> struct UnitTraits<KilogramPerCubicMeterTag> {
+  using dimension = dim::Density;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOGRAM_PER_CUBIC_METER; }
   static constexpr std::string_view symbol() { return "kg/m³"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<GramPerCubicCentimeterTag> {
+  using dimension = dim::Density;
   static constexpr UnitId unit_id() { return UNIT_ID_GRAM_PER_CUBIC_CENTIMETER; }
   static constexpr std::string_view symbol() { return "g/cm³"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<GramPerMilliliterTag> {
+  using dimension = dim::Density;
   static constexpr UnitId unit_id() { return UNIT_ID_GRAM_PER_MILLILITER; }
   static constexpr std::string_view symbol() { return "g/mL"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<PoundPerCubicFootTag> {
+  using dimension = dim::Density;
   static constexpr UnitId unit_id() { return UNIT_ID_POUND_PER_CUBIC_FOOT; }
   static constexpr std::string_view symbol() { return "lb/ft³"; }
+  static constexpr double to_si_factor() { return 1.601846337396014e1; }
 };
 
 using KilogramPerCubicMeter = Quantity<KilogramPerCubicMeterTag>;
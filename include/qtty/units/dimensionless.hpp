@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -15,28 +16,40 @@ struct IlluminationFractionTag {};
 struct RefractivityTag {};
 
 template <> struct UnitTraits<OpticalDepthTag> {
+  using dimension = dim::Dimensionless;
   static constexpr UnitId unit_id() { return UNIT_ID_OPTICAL_DEPTH; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<AirmassTag> {
+  using dimension = dim::Dimensionless;
   static constexpr UnitId unit_id() { return UNIT_ID_AIRMASS; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<TransmittanceTag> {
+  using dimension = dim::Dimensionless;
   static constexpr UnitId unit_id() { return UNIT_ID_TRANSMITTANCE; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<AlbedoTag> {
+  using dimension = dim::Dimensionless;
   static constexpr UnitId unit_id() { return UNIT_ID_ALBEDO; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<IlluminationFractionTag> {
+  using dimension = dim::Dimensionless;
   static constexpr UnitId unit_id() { return UNIT_ID_ILLUMINATION_FRACTION; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<RefractivityTag> {
+  using dimension = dim::Dimensionless;
   static constexpr UnitId unit_id() { return UNIT_ID_REFRACTIVITY; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 
 using OpticalDepth = Quantity<OpticalDepthTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -28,80 +29,118 @@ struct BritishThermalUnitTag {};
 struct ThermTag {};
 
 template <> struct UnitTraits<JouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_JOULE; }
   static constexpr std::string_view symbol() { return "J"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<PicojouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_PICOJOULE; }
   static constexpr std::string_view symbol() { return "pJ"; }
+  static constexpr double to_si_factor() { return 1e-12; }
 };
 template <> struct UnitTraits<NanojouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_NANOJOULE; }
   static constexpr std::string_view symbol() { return "nJ"; }
+  static constexpr double to_si_factor() { return 1e-9; }
 };
 template <> struct UnitTraits<MicrojouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROJOULE; }
   static constexpr std::string_view symbol() { return "µJ"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MillijouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIJOULE; }
   static constexpr std::string_view symbol() { return "mJ"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KilojouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOJOULE; }
   static constexpr std::string_view symbol() { return "kJ"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<MegajouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAJOULE; }
   static constexpr std::string_view symbol() { return "MJ"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 template <> struct UnitTraits<GigajouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGAJOULE; }
   static constexpr std::string_view symbol() { return "GJ"; }
+  static constexpr double to_si_factor() { return 1e9; }
 };
 template <> struct UnitTraits<TerajouleTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_TERAJOULE; }
   static constexpr std::string_view symbol() { return "TJ"; }
+  static constexpr double to_si_factor() { return 1e12; }
 };
 template <> struct UnitTraits<WattHourTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_WATT_HOUR; }
   static constexpr std::string_view symbol() { return "Wh"; }
+  static constexpr double to_si_factor() { return 3.6e3; }
 };
 template <> struct UnitTraits<KilowattHourTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOWATT_HOUR; }
   static constexpr std::string_view symbol() { return "kWh"; }
+  static constexpr double to_si_factor() { return 3.6e6; }
 };
 template <> struct UnitTraits<ErgTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_ERG; }
   static constexpr std::string_view symbol() { return "erg"; }
+  static constexpr double to_si_factor() { return 1e-7; }
 };
 template <> struct UnitTraits<ElectronvoltTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_ELECTRONVOLT; }
   static constexpr std::string_view symbol() { return "eV"; }
+  static constexpr double to_si_factor() { return 1.602176634e-19; }
 };
 template <> struct UnitTraits<KiloelectronvoltTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOELECTRONVOLT; }
   static constexpr std::string_view symbol() { return "keV"; }
+  static constexpr double to_si_factor() { return 1.602176634e-16; }
 };
 template <> struct UnitTraits<MegaelectronvoltTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAELECTRONVOLT; }
   static constexpr std::string_view symbol() { return "MeV"; }
+  static constexpr double to_si_factor() { return 1.602176634e-13; }
 };
 template <> struct UnitTraits<CalorieTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_CALORIE; }
   static constexpr std::string_view symbol() { return "cal"; }
+  static constexpr double to_si_factor() { return 4.184e0; }
 };
 template <> struct UnitTraits<KilocalorieTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOCALORIE; }
   static constexpr std::string_view symbol() { return "kcal"; }
+  static constexpr double to_si_factor() { return 4.184e3; }
 };
 template <> struct UnitTraits<BritishThermalUnitTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_BRITISH_THERMAL_UNIT; }
   static constexpr std::string_view symbol() { return "BTU"; }
+  static constexpr double to_si_factor() { return 1.05505585262e3; }
 };
 template <> struct UnitTraits<ThermTag> {
+  using dimension = dim::Energy;
   static constexpr UnitId unit_id() { return UNIT_ID_THERM; }
   static constexpr std::string_view symbol() { return "therm"; }
+  static constexpr double to_si_factor() { return 1.05505585262e8; }
 };
 
 using Joule = Quantity<JouleTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -17,36 +18,52 @@ struct DyneTag {};
 struct PoundForceTag {};
 
 template <> struct UnitTraits<NewtonTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_NEWTON; }
   static constexpr std::string_view symbol() { return "N"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MicronewtonTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_MICRONEWTON; }
   static constexpr std::string_view symbol() { return "µN"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MillinewtonTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLINEWTON; }
   static constexpr std::string_view symbol() { return "mN"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KilonewtonTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_KILONEWTON; }
   static constexpr std::string_view symbol() { return "kN"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<MeganewtonTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGANEWTON; }
   static constexpr std::string_view symbol() { return "MN"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 template <> struct UnitTraits<GiganewtonTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGANEWTON; }
   static constexpr std::string_view symbol() { return "GN"; }
+  static constexpr double to_si_factor() { return 1e9; }
 };
 template <> struct UnitTraits<DyneTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_DYNE; }
   static constexpr std::string_view symbol() { return "dyn"; }
+  static constexpr double to_si_factor() { return 1e-5; }
 };
 template <> struct UnitTraits<PoundForceTag> {
+  using dimension = dim::Force;
   static constexpr UnitId unit_id() { return UNIT_ID_POUND_FORCE; }
   static constexpr std::string_view symbol() { return "lbf"; }
+  static constexpr double to_si_factor() { return 4.4482216152605e0; }
 };
 
 using Newton = Quantity<NewtonTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -15,28 +16,40 @@ struct GigahertzTag {};
 struct TerahertzTag {};
 
 template <> struct UnitTraits<HertzTag> {
+  using dimension = dim::Frequency;
   static constexpr UnitId unit_id() { return UNIT_ID_HERTZ; }
   static constexpr std::string_view symbol() { return "Hz"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MillihertzTag> {
+  using dimension = dim::Frequency;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIHERTZ; }
   static constexpr std::string_view symbol() { return "mHz"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KilohertzTag> {
+  using dimension = dim::Frequency;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOHERTZ; }
   static constexpr std::string_view symbol() { return "kHz"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<MegahertzTag> {
+  using dimension = dim::Frequency;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAHERTZ; }
   static constexpr std::string_view symbol() { return "MHz"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 template <> struct UnitTraits<GigahertzTag> {
+  using dimension = dim::Frequency;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGAHERTZ; }
   static constexpr std::string_view symbol() { return "GHz"; }
+  static constexpr double to_si_factor() { return 1e9; }
 };
 template <> struct UnitTraits<TerahertzTag> {
+  using dimension = dim::Frequency;
   static constexpr UnitId unit_id() { return UNIT_ID_TERAHERTZ; }
   static constexpr std::string_view symbol() { return "THz"; }
+  static constexpr double to_si_factor() { return 1e12; }
 };
 
 using Hertz = Quantity<HertzTag>;
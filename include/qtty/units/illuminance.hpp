@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -12,16 +13,22 @@ struct MilliluxTag {};
 struct KiloluxTag {};
 
 template <> struct UnitTraits<LuxTag> {
+  using dimension = dim::Illuminance;
   static constexpr UnitId unit_id() { return UNIT_ID_LUX; }
   static constexpr std::string_view symbol() { return "lx"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MilliluxTag> {
+  using dimension = dim::Illuminance;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLILUX; }
   static constexpr std::string_view symbol() { return "mlx"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KiloluxTag> {
+  using dimension = dim::Illuminance;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOLUX; }
   static constexpr std::string_view symbol() { return "klx"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 
 using Lux = Quantity<LuxTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -12,16 +13,22 @@ struct MicrohenryTag {};
 struct MillihenryTag {};
 
 template <> struct UnitTraits<HenryTag> {
+  using dimension = dim::Inductance;
   static constexpr UnitId unit_id() { return UNIT_ID_HENRY; }
   static constexpr std::string_view symbol() { return "H"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MicrohenryTag> {
+  using dimension = dim::Inductance;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROHENRY; }
   static constexpr std::string_view symbol() { return "µH"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MillihenryTag> {
+  using dimension = dim::Inductance;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIHENRY; }
   static constexpr std::string_view symbol() { return "mH"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 
 using Henry = Quantity<HenryTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -10,6 +11,7 @@ namespace qtty {
 struct S10Tag {};
 
 template <> struct UnitTraits<S10Tag> {
+  using dimension = dim::InverseSolidAngle;
   static constexpr UnitId unit_id() { return UNIT_ID_S10; }
   static constexpr std::string_view symbol() { return "S10"; }
 };
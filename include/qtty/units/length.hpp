@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -59,204 +60,342 @@ struct NominalSolarRadiusTag {};
 struct NominalSolarDiameterTag {};
 
 template <> struct UnitTraits<PlanckLengthTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_PLANCK_LENGTH; }
   static constexpr std::string_view symbol() { return "lp"; }
+  static constexpr double to_si_factor() { return 1.616255e-35; }
 };
 template <> struct UnitTraits<YoctometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_YOCTOMETER; }
   static constexpr std::string_view symbol() { return "ym"; }
+  static constexpr double to_si_factor() { return 1e-24; }
 };
 template <> struct UnitTraits<ZeptometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_ZEPTOMETER; }
   static constexpr std::string_view symbol() { return "zm"; }
+  static constexpr double to_si_factor() { return 1e-21; }
 };
 template <> struct UnitTraits<AttometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_ATTOMETER; }
   static constexpr std::string_view symbol() { return "am"; }
+  static constexpr double to_si_factor() { return 1e-18; }
+  using si_ratio = std::ratio<1, 1000000000000000000>;
 };
 template <> struct UnitTraits<FemtometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_FEMTOMETER; }
   static constexpr std::string_view symbol() { return "fm"; }
+  static constexpr double to_si_factor() { return 1e-15; }
+  using si_ratio = std::ratio<1, 1000000000000000>;
 };
 template <> struct UnitTraits<PicometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_PICOMETER; }
   static constexpr std::string_view symbol() { return "pm"; }
+  static constexpr double to_si_factor() { return 1e-12; }
+  using si_ratio = std::ratio<1, 1000000000000>;
 };
 template <> struct UnitTraits<NanometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NANOMETER; }
   static constexpr std::string_view symbol() { return "nm"; }
+  static constexpr double to_si_factor() { return 1e-9; }
+  using si_ratio = std::ratio<1, 1000000000>;
 };
 template <> struct UnitTraits<MicrometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROMETER; }
   static constexpr std::string_view symbol() { return "μm"; }
+  static constexpr double to_si_factor() { return 1e-6; }
+  using si_ratio = std::ratio<1, 1000000>;
 };
 template <> struct UnitTraits<MillimeterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIMETER; }
   static constexpr std::string_view symbol() { return "mm"; }
+  static constexpr double to_si_factor() { return 1e-3; }
+  using si_ratio = std::ratio<1, 1000>;
 };
 template <> struct UnitTraits<CentimeterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_CENTIMETER; }
   static constexpr std::string_view symbol() { return "cm"; }
+  static constexpr double to_si_factor() { return 1e-2; }
+  using si_ratio = std::ratio<1, 100>;
 };
 template <> struct UnitTraits<DecimeterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_DECIMETER; }
   static constexpr std::string_view symbol() { return "dm"; }
+  static constexpr double to_si_factor() { return 1e-1; }
+  using si_ratio = std::ratio<1, 10>;
 };
 template <> struct UnitTraits<MeterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_METER; }
   static constexpr std::string_view symbol() { return "m"; }
+  static constexpr double to_si_factor() { return 1e0; }
+  using si_ratio = std::ratio<1, 1>;
 };
 template <> struct UnitTraits<DecameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_DECAMETER; }
   static constexpr std::string_view symbol() { return "dam"; }
+  static constexpr double to_si_factor() { return 1e1; }
+  using si_ratio = std::ratio<10, 1>;
 };
 template <> struct UnitTraits<HectometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_HECTOMETER; }
   static constexpr std::string_view symbol() { return "hm"; }
+  static constexpr double to_si_factor() { return 1e2; }
+  using si_ratio = std::ratio<100, 1>;
 };
 template <> struct UnitTraits<KilometerTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOMETER; }
   static constexpr std::string_view symbol() { return "km"; }
+  static constexpr double to_si_factor() { return 1e3; }
+  using si_ratio = std::ratio<1000, 1>;
 };
 template <> struct UnitTraits<MegameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAMETER; }
   static constexpr std::string_view symbol() { return "Mm"; }
+  static constexpr double to_si_factor() { return 1e6; }
+  using si_ratio = std::ratio<1000000, 1>;
 };
 template <> struct UnitTraits<GigameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGAMETER; }
   static constexpr std::string_view symbol() { return "Gm"; }
+  static constexpr double to_si_factor() { return 1e9; }
+  using si_ratio = std::ratio<1000000000, 1>;
 };
 template <> struct UnitTraits<TerameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_TERAMETER; }
   static constexpr std::string_view symbol() { return "Tm"; }
+  static constexpr double to_si_factor() { return 1e12; }
+  using si_ratio = std::ratio<1000000000000, 1>;
 };
 template <> struct UnitTraits<PetameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_PETAMETER; }
   static constexpr std::string_view symbol() { return "Pm"; }
+  static constexpr double to_si_factor() { return 1e15; }
+  using si_ratio = std::ratio<1000000000000000, 1>;
 };
 template <> struct UnitTraits<ExameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_EXAMETER; }
   static constexpr std::string_view symbol() { return "Em"; }
+  static constexpr double to_si_factor() { return 1e18; }
+  using si_ratio = std::ratio<1000000000000000000, 1>;
 };
 template <> struct UnitTraits<ZettameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_ZETTAMETER; }
   static constexpr std::string_view symbol() { return "Zm"; }
+  static constexpr double to_si_factor() { return 1e21; }
 };
 template <> struct UnitTraits<YottameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_YOTTAMETER; }
   static constexpr std::string_view symbol() { return "Ym"; }
+  static constexpr double to_si_factor() { return 1e24; }
 };
 template <> struct UnitTraits<BohrRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_BOHR_RADIUS; }
   static constexpr std::string_view symbol() { return "a0"; }
+  static constexpr double to_si_factor() { return 5.29177210903e-11; }
 };
 template <> struct UnitTraits<ClassicalElectronRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_CLASSICAL_ELECTRON_RADIUS; }
   static constexpr std::string_view symbol() { return "re"; }
+  static constexpr double to_si_factor() { return 2.8179403262e-15; }
 };
 template <> struct UnitTraits<ElectronReducedComptonWavelengthTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_ELECTRON_REDUCED_COMPTON_WAVELENGTH; }
   static constexpr std::string_view symbol() { return "lambda_bar_e"; }
+  static constexpr double to_si_factor() { return 3.8615926796e-13; }
 };
 template <> struct UnitTraits<AstronomicalUnitTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_ASTRONOMICAL_UNIT; }
   static constexpr std::string_view symbol() { return "au"; }
+  static constexpr double to_si_factor() { return 1.495978707e11; }
+  using si_ratio = std::ratio<149597870700, 1>;
 };
 template <> struct UnitTraits<LightYearTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_LIGHT_YEAR; }
   static constexpr std::string_view symbol() { return "ly"; }
+  static constexpr double to_si_factor() { return 9.4607304725808e15; }
+  using si_ratio = std::ratio<9460730472580800, 1>;
 };
 template <> struct UnitTraits<ParsecTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_PARSEC; }
   static constexpr std::string_view symbol() { return "pc"; }
+  static constexpr double to_si_factor() { return 3.085677581491367e16; }
 };
 template <> struct UnitTraits<KiloparsecTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOPARSEC; }
   static constexpr std::string_view symbol() { return "kpc"; }
+  static constexpr double to_si_factor() { return 3.085677581491367e19; }
 };
 template <> struct UnitTraits<MegaparsecTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAPARSEC; }
   static constexpr std::string_view symbol() { return "Mpc"; }
+  static constexpr double to_si_factor() { return 3.085677581491367e22; }
 };
 template <> struct UnitTraits<GigaparsecTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGAPARSEC; }
   static constexpr std::string_view symbol() { return "Gpc"; }
+  static constexpr double to_si_factor() { return 3.0856775814913673e25; }
 };
 template <> struct UnitTraits<InchTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_INCH; }
   static constexpr std::string_view symbol() { return "in"; }
+  static constexpr double to_si_factor() { return 2.54e-2; }
+  using si_ratio = std::ratio<127, 5000>;
 };
 template <> struct UnitTraits<FootTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_FOOT; }
   static constexpr std::string_view symbol() { return "ft"; }
+  static constexpr double to_si_factor() { return 3.048e-1; }
+  using si_ratio = std::ratio<381, 1250>;
 };
 template <> struct UnitTraits<YardTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_YARD; }
   static constexpr std::string_view symbol() { return "yd"; }
+  static constexpr double to_si_factor() { return 9.144e-1; }
+  using si_ratio = std::ratio<1143, 1250>;
 };
 template <> struct UnitTraits<MileTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_MILE; }
   static constexpr std::string_view symbol() { return "mi"; }
+  static constexpr double to_si_factor() { return 1.609344e3; }
+  using si_ratio = std::ratio<201168, 125>;
 };
 template <> struct UnitTraits<LinkTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_LINK; }
   static constexpr std::string_view symbol() { return "lk"; }
+  static constexpr double to_si_factor() { return 2.01168e-1; }
+  using si_ratio = std::ratio<12573, 62500>;
 };
 template <> struct UnitTraits<FathomTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_FATHOM; }
   static constexpr std::string_view symbol() { return "ftm"; }
+  static constexpr double to_si_factor() { return 1.8288e0; }
+  using si_ratio = std::ratio<1143, 625>;
 };
 template <> struct UnitTraits<RodTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_ROD; }
   static constexpr std::string_view symbol() { return "rd"; }
+  static constexpr double to_si_factor() { return 5.0292e0; }
+  using si_ratio = std::ratio<12573, 2500>;
 };
 template <> struct UnitTraits<ChainTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_CHAIN; }
   static constexpr std::string_view symbol() { return "ch"; }
+  static constexpr double to_si_factor() { return 2.01168e1; }
+  using si_ratio = std::ratio<12573, 625>;
 };
 template <> struct UnitTraits<NauticalMileTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NAUTICAL_MILE; }
   static constexpr std::string_view symbol() { return "nmi"; }
+  static constexpr double to_si_factor() { return 1.852e3; }
+  using si_ratio = std::ratio<1852, 1>;
 };
 template <> struct UnitTraits<NominalLunarRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_LUNAR_RADIUS; }
   static constexpr std::string_view symbol() { return "Rmoon"; }
+  static constexpr double to_si_factor() { return 1.7374e6; }
+  using si_ratio = std::ratio<1737400, 1>;
 };
 template <> struct UnitTraits<NominalLunarDistanceTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_LUNAR_DISTANCE; }
   static constexpr std::string_view symbol() { return "LD"; }
+  static constexpr double to_si_factor() { return 3.844e8; }
+  using si_ratio = std::ratio<384400000, 1>;
 };
 template <> struct UnitTraits<NominalEarthPolarRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_EARTH_POLAR_RADIUS; }
   static constexpr std::string_view symbol() { return "Rearth_p"; }
+  static constexpr double to_si_factor() { return 6.3568e6; }
+  using si_ratio = std::ratio<6356800, 1>;
 };
 template <> struct UnitTraits<NominalEarthRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_EARTH_RADIUS; }
   static constexpr std::string_view symbol() { return "Rearth"; }
+  static constexpr double to_si_factor() { return 6.371e6; }
+  using si_ratio = std::ratio<6371000, 1>;
 };
 template <> struct UnitTraits<NominalEarthEquatorialRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_EARTH_EQUATORIAL_RADIUS; }
   static constexpr std::string_view symbol() { return "Rearth_eq"; }
+  static constexpr double to_si_factor() { return 6.3781e6; }
+  using si_ratio = std::ratio<6378100, 1>;
 };
 template <> struct UnitTraits<EarthMeridionalCircumferenceTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_EARTH_MERIDIONAL_CIRCUMFERENCE; }
   static constexpr std::string_view symbol() { return "Cmer"; }
+  static constexpr double to_si_factor() { return 4.0007863e7; }
+  using si_ratio = std::ratio<40007863, 1>;
 };
 template <> struct UnitTraits<EarthEquatorialCircumferenceTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_EARTH_EQUATORIAL_CIRCUMFERENCE; }
   static constexpr std::string_view symbol() { return "Ceq"; }
+  static constexpr double to_si_factor() { return 4.0075017e7; }
+  using si_ratio = std::ratio<40075017, 1>;
 };
 template <> struct UnitTraits<NominalJupiterRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_JUPITER_RADIUS; }
   static constexpr std::string_view symbol() { return "Rjup"; }
+  static constexpr double to_si_factor() { return 7.1492e7; }
+  using si_ratio = std::ratio<71492000, 1>;
 };
 template <> struct UnitTraits<NominalSolarRadiusTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_SOLAR_RADIUS; }
   static constexpr std::string_view symbol() { return "Rsun"; }
+  static constexpr double to_si_factor() { return 6.957e8; }
+  using si_ratio = std::ratio<695700000, 1>;
 };
 template <> struct UnitTraits<NominalSolarDiameterTag> {
+  using dimension = dim::Length;
   static constexpr UnitId unit_id() { return UNIT_ID_NOMINAL_SOLAR_DIAMETER; }
   static constexpr std::string_view symbol() { return "Dsun"; }
+  static constexpr double to_si_factor() { return 1.3914e9; }
+  using si_ratio = std::ratio<1391400000, 1>;
 };
 
 using PlanckLength = Quantity<PlanckLengthTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -12,16 +13,22 @@ struct MillilumenTag {};
 struct KilolumenTag {};
 
 template <> struct UnitTraits<LumenTag> {
+  using dimension = dim::LuminousFlux;
   static constexpr UnitId unit_id() { return UNIT_ID_LUMEN; }
   static constexpr std::string_view symbol() { return "lm"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MillilumenTag> {
+  using dimension = dim::LuminousFlux;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLILUMEN; }
   static constexpr std::string_view symbol() { return "mlm"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KilolumenTag> {
+  using dimension = dim::LuminousFlux;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOLUMEN; }
   static constexpr std::string_view symbol() { return "klm"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 
 using Lumen = Quantity<LumenTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -10,8 +11,10 @@ namespace qtty {
 struct CandelaTag {};
 
 template <> struct UnitTraits<CandelaTag> {
+  using dimension = dim::LuminousIntensity;
   static constexpr UnitId unit_id() { return UNIT_ID_CANDELA; }
   static constexpr std::string_view symbol() { return "cd"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 
 using Candela = Quantity<CandelaTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -11,12 +12,16 @@ struct WeberTag {};
 struct MilliweberTag {};
 
 template <> struct UnitTraits<WeberTag> {
+  using dimension = dim::MagneticFlux;
   static constexpr UnitId unit_id() { return UNIT_ID_WEBER; }
   static constexpr std::string_view symbol() { return "Wb"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MilliweberTag> {
+  using dimension = dim::MagneticFlux;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIWEBER; }
   static constexpr std::string_view symbol() { return "mWb"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 
 using Weber = Quantity<WeberTag>;
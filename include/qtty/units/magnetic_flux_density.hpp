@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -12,16 +13,22 @@ struct MilliteslaTag {};
 struct MicroteslaTag {};
 
 template <> struct UnitTraits<TeslaTag> {
+  using dimension = dim::MagneticFluxDensity;
   static constexpr UnitId unit_id() { return UNIT_ID_TESLA; }
   static constexpr std::string_view symbol() { return "T"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MilliteslaTag> {
+  using dimension = dim::MagneticFluxDensity;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLITESLA; }
   static constexpr std::string_view symbol() { return "mT"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<MicroteslaTag> {
+  using dimension = dim::MagneticFluxDensity;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROTESLA; }
   static constexpr std::string_view symbol() { return "µT"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 
 using Tesla = Quantity<TeslaTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -40,128 +41,190 @@ struct AtomicMassUnitTag {};
 struct SolarMassTag {};
 
 template <> struct UnitTraits<YoctogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_YOCTOGRAM; }
   static constexpr std::string_view symbol() { return "yg"; }
+  static constexpr double to_si_factor() { return 1e-27; }
 };
 template <> struct UnitTraits<ZeptogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_ZEPTOGRAM; }
   static constexpr std::string_view symbol() { return "zg"; }
+  static constexpr double to_si_factor() { return 1e-24; }
 };
 template <> struct UnitTraits<AttogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_ATTOGRAM; }
   static constexpr std::string_view symbol() { return "ag"; }
+  static constexpr double to_si_factor() { return 1e-21; }
 };
 template <> struct UnitTraits<FemtogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_FEMTOGRAM; }
   static constexpr std::string_view symbol() { return "fg"; }
+  static constexpr double to_si_factor() { return 1e-18; }
 };
 template <> struct UnitTraits<PicogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_PICOGRAM; }
   static constexpr std::string_view symbol() { return "pg"; }
+  static constexpr double to_si_factor() { return 1e-15; }
 };
 template <> struct UnitTraits<NanogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_NANOGRAM; }
   static constexpr std::string_view symbol() { return "ng"; }
+  static constexpr double to_si_factor() { return 1e-12; }
 };
 template <> struct UnitTraits<MicrogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROGRAM; }
   static constexpr std::string_view symbol() { return "µg"; }
+  static constexpr double to_si_factor() { return 1e-9; }
 };
 template <> struct UnitTraits<MilligramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIGRAM; }
   static constexpr std::string_view symbol() { return "mg"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<CentigramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_CENTIGRAM; }
   static constexpr std::string_view symbol() { return "cg"; }
+  static constexpr double to_si_factor() { return 1e-5; }
 };
 template <> struct UnitTraits<DecigramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_DECIGRAM; }
   static constexpr std::string_view symbol() { return "dg"; }
+  static constexpr double to_si_factor() { return 1e-4; }
 };
 template <> struct UnitTraits<GramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_GRAM; }
   static constexpr std::string_view symbol() { return "g"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<DecagramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_DECAGRAM; }
   static constexpr std::string_view symbol() { return "dag"; }
+  static constexpr double to_si_factor() { return 1e-2; }
 };
 template <> struct UnitTraits<HectogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_HECTOGRAM; }
   static constexpr std::string_view symbol() { return "hg"; }
+  static constexpr double to_si_factor() { return 1e-1; }
 };
 template <> struct UnitTraits<KilogramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOGRAM; }
   static constexpr std::string_view symbol() { return "kg"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MegagramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAGRAM; }
   static constexpr std::string_view symbol() { return "Mg"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<GigagramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGAGRAM; }
   static constexpr std::string_view symbol() { return "Gg"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 template <> struct UnitTraits<TeragramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_TERAGRAM; }
   static constexpr std::string_view symbol() { return "Tg"; }
+  static constexpr double to_si_factor() { return 1e9; }
 };
 template <> struct UnitTraits<PetagramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_PETAGRAM; }
   static constexpr std::string_view symbol() { return "Pg"; }
+  static constexpr double to_si_factor() { return 1e12; }
 };
 template <> struct UnitTraits<ExagramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_EXAGRAM; }
   static constexpr std::string_view symbol() { return "Eg"; }
+  static constexpr double to_si_factor() { return 1e15; }
 };
 template <> struct UnitTraits<ZettagramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_ZETTAGRAM; }
   static constexpr std::string_view symbol() { return "Zg"; }
+  static constexpr double to_si_factor() { return 1e18; }
 };
 template <> struct UnitTraits<YottagramTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_YOTTAGRAM; }
   static constexpr std::string_view symbol() { return "Yg"; }
+  static constexpr double to_si_factor() { return 1e21; }
 };
 template <> struct UnitTraits<GrainTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_GRAIN; }
   static constexpr std::string_view symbol() { return "gr"; }
+  static constexpr double to_si_factor() { return 6.479891e-5; }
 };
 template <> struct UnitTraits<OunceTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_OUNCE; }
   static constexpr std::string_view symbol() { return "oz"; }
+  static constexpr double to_si_factor() { return 2.8349523125e-2; }
 };
 template <> struct UnitTraits<PoundTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_POUND; }
   static constexpr std::string_view symbol() { return "lb"; }
+  static constexpr double to_si_factor() { return 4.5359237e-1; }
 };
 template <> struct UnitTraits<StoneTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_STONE; }
   static constexpr std::string_view symbol() { return "st"; }
+  static constexpr double to_si_factor() { return 6.35029318e0; }
 };
 template <> struct UnitTraits<ShortTonTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_SHORT_TON; }
   static constexpr std::string_view symbol() { return "ton_us"; }
+  static constexpr double to_si_factor() { return 9.0718474e2; }
 };
 template <> struct UnitTraits<LongTonTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_LONG_TON; }
   static constexpr std::string_view symbol() { return "ton_uk"; }
+  static constexpr double to_si_factor() { return 1.0160469088e3; }
 };
 template <> struct UnitTraits<CaratTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_CARAT; }
   static constexpr std::string_view symbol() { return "ct"; }
+  static constexpr double to_si_factor() { return 2e-4; }
 };
 template <> struct UnitTraits<TonneTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_TONNE; }
   static constexpr std::string_view symbol() { return "t"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<AtomicMassUnitTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_ATOMIC_MASS_UNIT; }
   static constexpr std::string_view symbol() { return "u"; }
+  static constexpr double to_si_factor() { return 1.6605390666e-27; }
 };
 template <> struct UnitTraits<SolarMassTag> {
+  using dimension = dim::Mass;
   static constexpr UnitId unit_id() { return UNIT_ID_SOLAR_MASS; }
   static constexpr std::string_view symbol() { return "M☉"; }
+  static constexpr double to_si_factor() { return 1.98847e30; }
 };
 
 using Yoctogram = Quantity<YoctogramTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -12,20 +13,26 @@ struct PhotonPerSquareCentimeterSecondSteradianTag {};
 struct PhotonPerSquareCentimeterNanosecondSteradianTag {};
 
 template <> struct UnitTraits<PhotonPerSquareMeterSecondSteradianTag> {
+  using dimension = dim::PhotonRadiance;
   static constexpr UnitId unit_id() { return UNIT_ID_PHOTON_PER_SQUARE_METER_SECOND_STERADIAN; }
   static constexpr std::string_view symbol() { return "ph·m⁻²·s⁻¹·sr⁻¹"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<PhotonPerSquareCentimeterSecondSteradianTag> {
+  using dimension = dim::PhotonRadiance;
   static constexpr UnitId unit_id() {
     return UNIT_ID_PHOTON_PER_SQUARE_CENTIMETER_SECOND_STERADIAN;
   }
   static constexpr std::string_view symbol() { return "ph·cm⁻²·s⁻¹·sr⁻¹"; }
+  static constexpr double to_si_factor() { return 1e4; }
 };
 template <> struct UnitTraits<PhotonPerSquareCentimeterNanosecondSteradianTag> {
+  using dimension = dim::PhotonRadiance;
   static constexpr UnitId unit_id() {
     return UNIT_ID_PHOTON_PER_SQUARE_CENTIMETER_NANOSECOND_STERADIAN;
   }
   static constexpr std::string_view symbol() { return "ph·cm⁻²·ns⁻¹·sr⁻¹"; }
+  static constexpr double to_si_factor() { return 1e13; }
 };
 
 using PhotonPerSquareMeterSecondSteradian = Quantity<PhotonPerSquareMeterSecondSteradianTag>;
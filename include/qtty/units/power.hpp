@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -33,100 +34,148 @@ struct HorsepowerElectricTag {};
 struct SolarLuminosityTag {};
 
 template <> struct UnitTraits<YoctowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_YOCTOWATT; }
   static constexpr std::string_view symbol() { return "yW"; }
+  static constexpr double to_si_factor() { return 1e-24; }
 };
 template <> struct UnitTraits<ZeptowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_ZEPTOWATT; }
   static constexpr std::string_view symbol() { return "zW"; }
+  static constexpr double to_si_factor() { return 1e-21; }
 };
 template <> struct UnitTraits<AttowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_ATTOWATT; }
   static constexpr std::string_view symbol() { return "aW"; }
+  static constexpr double to_si_factor() { return 1e-18; }
 };
 template <> struct UnitTraits<FemtowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_FEMTOWATT; }
   static constexpr std::string_view symbol() { return "fW"; }
+  static constexpr double to_si_factor() { return 1e-15; }
 };
 template <> struct UnitTraits<PicowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_PICOWATT; }
   static constexpr std::string_view symbol() { return "pW"; }
+  static constexpr double to_si_factor() { return 1e-12; }
 };
 template <> struct UnitTraits<NanowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_NANOWATT; }
   static constexpr std::string_view symbol() { return "nW"; }
+  static constexpr double to_si_factor() { return 1e-9; }
 };
 template <> struct UnitTraits<MicrowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROWATT; }
   static constexpr std::string_view symbol() { return "µW"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MilliwattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIWATT; }
   static constexpr std::string_view symbol() { return "mW"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<DeciwattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_DECIWATT; }
   static constexpr std::string_view symbol() { return "dW"; }
+  static constexpr double to_si_factor() { return 1e-1; }
 };
 template <> struct UnitTraits<WattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_WATT; }
   static constexpr std::string_view symbol() { return "W"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<DecawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_DECAWATT; }
   static constexpr std::string_view symbol() { return "daW"; }
+  static constexpr double to_si_factor() { return 1e1; }
 };
 template <> struct UnitTraits<HectowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_HECTOWATT; }
   static constexpr std::string_view symbol() { return "hW"; }
+  static constexpr double to_si_factor() { return 1e2; }
 };
 template <> struct UnitTraits<KilowattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOWATT; }
   static constexpr std::string_view symbol() { return "kW"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<MegawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAWATT; }
   static constexpr std::string_view symbol() { return "MW"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 template <> struct UnitTraits<GigawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGAWATT; }
   static constexpr std::string_view symbol() { return "GW"; }
+  static constexpr double to_si_factor() { return 1e9; }
 };
 template <> struct UnitTraits<TerawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_TERAWATT; }
   static constexpr std::string_view symbol() { return "TW"; }
+  static constexpr double to_si_factor() { return 1e12; }
 };
 template <> struct UnitTraits<PetawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_PETAWATT; }
   static constexpr std::string_view symbol() { return "PW"; }
+  static constexpr double to_si_factor() { return 1e15; }
 };
 template <> struct UnitTraits<ExawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_EXAWATT; }
   static constexpr std::string_view symbol() { return "EW"; }
+  static constexpr double to_si_factor() { return 1e18; }
 };
 template <> struct UnitTraits<ZettawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_ZETTAWATT; }
   static constexpr std::string_view symbol() { return "ZW"; }
+  static constexpr double to_si_factor() { return 1e21; }
 };
 template <> struct UnitTraits<YottawattTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_YOTTAWATT; }
   static constexpr std::string_view symbol() { return "YW"; }
+  static constexpr double to_si_factor() { return 1e24; }
 };
 template <> struct UnitTraits<ErgPerSecondTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_ERG_PER_SECOND; }
   static constexpr std::string_view symbol() { return "erg/s"; }
+  static constexpr double to_si_factor() { return 1e-7; }
 };
 template <> struct UnitTraits<HorsepowerMetricTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_HORSEPOWER_METRIC; }
   static constexpr std::string_view symbol() { return "PS"; }
+  static constexpr double to_si_factor() { return 7.3549875e2; }
 };
 template <> struct UnitTraits<HorsepowerElectricTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_HORSEPOWER_ELECTRIC; }
   static constexpr std::string_view symbol() { return "hp_e"; }
+  static constexpr double to_si_factor() { return 7.46e2; }
 };
 template <> struct UnitTraits<SolarLuminosityTag> {
+  using dimension = dim::Power;
   static constexpr UnitId unit_id() { return UNIT_ID_SOLAR_LUMINOSITY; }
   static constexpr std::string_view symbol() { return "L☉"; }
+  static constexpr double to_si_factor() { return 3.828e26; }
 };
 
 using Yoctowatt = Quantity<YoctowattTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -21,52 +22,76 @@ struct PoundPerSquareInchTag {};
 struct InchOfMercuryTag {};
 
 template <> struct UnitTraits<PascalTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_PASCAL; }
   static constexpr std::string_view symbol() { return "Pa"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MillipascalTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIPASCAL; }
   static constexpr std::string_view symbol() { return "mPa"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<HectopascalTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_HECTOPASCAL; }
   static constexpr std::string_view symbol() { return "hPa"; }
+  static constexpr double to_si_factor() { return 1e2; }
 };
 template <> struct UnitTraits<KilopascalTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOPASCAL; }
   static constexpr std::string_view symbol() { return "kPa"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<MegapascalTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAPASCAL; }
   static constexpr std::string_view symbol() { return "MPa"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 template <> struct UnitTraits<GigapascalTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGAPASCAL; }
   static constexpr std::string_view symbol() { return "GPa"; }
+  static constexpr double to_si_factor() { return 1e9; }
 };
 template <> struct UnitTraits<BarTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_BAR; }
   static constexpr std::string_view symbol() { return "bar"; }
+  static constexpr double to_si_factor() { return 1e5; }
 };
 template <> struct UnitTraits<AtmosphereTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_ATMOSPHERE; }
   static constexpr std::string_view symbol() { return "atm"; }
+  static constexpr double to_si_factor() { return 1.01325e5; }
 };
 template <> struct UnitTraits<TorrTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_TORR; }
   static constexpr std::string_view symbol() { return "Torr"; }
+  static constexpr double to_si_factor() { return 1.3332236842105263e2; }
 };
 template <> struct UnitTraits<MillimeterOfMercuryTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIMETER_OF_MERCURY; }
   static constexpr std::string_view symbol() { return "mmHg"; }
+  static constexpr double to_si_factor() { return 1.33322387415e2; }
 };
 template <> struct UnitTraits<PoundPerSquareInchTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_POUND_PER_SQUARE_INCH; }
   static constexpr std::string_view symbol() { return "psi"; }
+  static constexpr double to_si_factor() { return 6.894757293168361e3; }
 };
 template <> struct UnitTraits<InchOfMercuryTag> {
+  using dimension = dim::Pressure;
   static constexpr UnitId unit_id() { return UNIT_ID_INCH_OF_MERCURY; }
   static constexpr std::string_view symbol() { return "inHg"; }
+  static constexpr double to_si_factor() { return 3.38638864e3; }
 };
 
 using Pascal = Quantity<PascalTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -11,12 +12,16 @@ struct WattPerSquareMeterSteradianTag {};
 struct ErgPerSecondSquareCentimeterSteradianTag {};
 
 template <> struct UnitTraits<WattPerSquareMeterSteradianTag> {
+  using dimension = dim::Radiance;
   static constexpr UnitId unit_id() { return UNIT_ID_WATT_PER_SQUARE_METER_STERADIAN; }
   static constexpr std::string_view symbol() { return "W·m⁻²·sr⁻¹"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<ErgPerSecondSquareCentimeterSteradianTag> {
+  using dimension = dim::Radiance;
   static constexpr UnitId unit_id() { return UNIT_ID_ERG_PER_SECOND_SQUARE_CENTIMETER_STERADIAN; }
   static constexpr std::string_view symbol() { return "erg·s⁻¹·cm⁻²·sr⁻¹"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 
 using WattPerSquareMeterSteradian = Quantity<WattPerSquareMeterSteradianTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -13,20 +14,28 @@ struct KilohmTag {};
 struct MegaohmTag {};
 
 template <> struct UnitTraits<OhmTag> {
+  using dimension = dim::Resistance;
   static constexpr UnitId unit_id() { return UNIT_ID_OHM; }
   static constexpr std::string_view symbol() { return "Ω"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MilliohmTag> {
+  using dimension = dim::Resistance;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIOHM; }
   static constexpr std::string_view symbol() { return "mΩ"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KilohmTag> {
+  using dimension = dim::Resistance;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOHM; }
   static constexpr std::string_view symbol() { return "kΩ"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<MegaohmTag> {
+  using dimension = dim::Resistance;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAOHM; }
   static constexpr std::string_view symbol() { return "MΩ"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 
 using Ohm = Quantity<OhmTag>;
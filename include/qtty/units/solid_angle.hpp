@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -14,24 +15,34 @@ struct SquareArcminuteTag {};
 struct SquareArcsecondTag {};
 
 template <> struct UnitTraits<SquareDegreeTag> {
+  using dimension = dim::SolidAngle;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_DEGREE; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 3.0461741978670857e-4; }
 };
 template <> struct UnitTraits<SteradianTag> {
+  using dimension = dim::SolidAngle;
   static constexpr UnitId unit_id() { return UNIT_ID_STERADIAN; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<SquareMilliradianTag> {
+  using dimension = dim::SolidAngle;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_MILLIRADIAN; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<SquareArcminuteTag> {
+  using dimension = dim::SolidAngle;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_ARCMINUTE; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 8.461594994075237e-8; }
 };
 template <> struct UnitTraits<SquareArcsecondTag> {
+  using dimension = dim::SolidAngle;
   static constexpr UnitId unit_id() { return UNIT_ID_SQUARE_ARCSECOND; }
   static constexpr std::string_view symbol() { return ""; }
+  static constexpr double to_si_factor() { return 2.3504430539097885e-11; }
 };
 
 using SquareDegree = Quantity<SquareDegreeTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -13,28 +14,36 @@ struct PhotonPerSquareCentimeterSecondSteradianNanometerTag {};
 struct PhotonPerSquareCentimeterNanosecondSteradianNanometerTag {};
 
 template <> struct UnitTraits<PhotonPerSquareMeterSecondSteradianMeterTag> {
+  using dimension = dim::SpectralPhotonRadiance;
   static constexpr UnitId unit_id() {
     return UNIT_ID_PHOTON_PER_SQUARE_METER_SECOND_STERADIAN_METER;
   }
   static constexpr std::string_view symbol() { return "ph·m⁻²·s⁻¹·sr⁻¹·m⁻¹"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<PhotonPerSquareCentimeterSecondSteradianAngstromTag> {
+  using dimension = dim::SpectralPhotonRadiance;
   static constexpr UnitId unit_id() {
     return UNIT_ID_PHOTON_PER_SQUARE_CENTIMETER_SECOND_STERADIAN_ANGSTROM;
   }
   static constexpr std::string_view symbol() { return "ph·cm⁻²·s⁻¹·sr⁻¹·Å⁻¹"; }
+  static constexpr double to_si_factor() { return 1e14; }
 };
 template <> struct UnitTraits<PhotonPerSquareCentimeterSecondSteradianNanometerTag> {
+  using dimension = dim::SpectralPhotonRadiance;
   static constexpr UnitId unit_id() {
     return UNIT_ID_PHOTON_PER_SQUARE_CENTIMETER_SECOND_STERADIAN_NANOMETER;
   }
   static constexpr std::string_view symbol() { return "ph·cm⁻²·s⁻¹·sr⁻¹·nm⁻¹"; }
+  static constexpr double to_si_factor() { return 1e13; }
 };
 template <> struct UnitTraits<PhotonPerSquareCentimeterNanosecondSteradianNanometerTag> {
+  using dimension = dim::SpectralPhotonRadiance;
   static constexpr UnitId unit_id() {
     return UNIT_ID_PHOTON_PER_SQUARE_CENTIMETER_NANOSECOND_STERADIAN_NANOMETER;
   }
   static constexpr std::string_view symbol() { return "ph·cm⁻²·ns⁻¹·sr⁻¹·nm⁻¹"; }
+  static constexpr double to_si_factor() { return 1e22; }
 };
 
 using PhotonPerSquareMeterSecondSteradianMeter =
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -12,18 +13,24 @@ struct WattPerSquareMeterSteradianNanometerTag {};
 struct ErgPerSecondSquareCentimeterSteradianAngstromTag {};
 
 template <> struct UnitTraits<WattPerSquareMeterSteradianMeterTag> {
+  using dimension = dim::SpectralRadiance;
   static constexpr UnitId unit_id() { return UNIT_ID_WATT_PER_SQUARE_METER_STERADIAN_METER; }
   static constexpr std::string_view symbol() { return "W·m⁻²·sr⁻¹·m⁻¹"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<WattPerSquareMeterSteradianNanometerTag> {
+  using dimension = dim::SpectralRadiance;
   static constexpr UnitId unit_id() { return UNIT_ID_WATT_PER_SQUARE_METER_STERADIAN_NANOMETER; }
   static constexpr std::string_view symbol() { return "W·m⁻²·sr⁻¹·nm⁻¹"; }
+  static constexpr double to_si_factor() { return 1e9; }
 };
 template <> struct UnitTraits<ErgPerSecondSquareCentimeterSteradianAngstromTag> {
+  using dimension = dim::SpectralRadiance;
   static constexpr UnitId unit_id() {
     return UNIT_ID_ERG_PER_SECOND_SQUARE_CENTIMETER_STERADIAN_ANGSTROM;
   }
   static constexpr std::string_view symbol() { return "erg·s⁻¹·cm⁻²·sr⁻¹·Å⁻¹"; }
+  static constexpr double to_si_factor() { return 1e7; }
 };
 
 using WattPerSquareMeterSteradianMeter = Quantity<WattPerSquareMeterSteradianMeterTag>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -11,12 +12,16 @@ struct KelvinTag {};
 struct RankineTag {};
 
 template <> struct UnitTraits<KelvinTag> {
+  using dimension = dim::Temperature;
   static constexpr UnitId unit_id() { return UNIT_ID_KELVIN; }
   static constexpr std::string_view symbol() { return "K"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<RankineTag> {
+  using dimension = dim::Temperature;
   static constexpr UnitId unit_id() { return UNIT_ID_RANKINE; }
   static constexpr std::string_view symbol() { return "°R"; }
+  static constexpr double to_si_factor() { return 5.555555555555556e-1; }
 };
 
 using Kelvin = Quantity<KelvinTag>;
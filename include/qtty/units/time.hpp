@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -38,120 +39,207 @@ struct SynodicMonthTag {};
 struct SiderealYearTag {};
 
 template <> struct UnitTraits<AttosecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_ATTOSECOND; }
   static constexpr std::string_view symbol() { return "as"; }
+  static constexpr double to_si_factor() { return 1e-18; }
+  using si_ratio = std::ratio<1, 1000000000000000000>;
 };
 template <> struct UnitTraits<FemtosecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_FEMTOSECOND; }
   static constexpr std::string_view symbol() { return "fs"; }
+  static constexpr double to_si_factor() { return 1e-15; }
+  using si_ratio = std::ratio<1, 1000000000000000>;
 };
 template <> struct UnitTraits<PicosecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_PICOSECOND; }
   static constexpr std::string_view symbol() { return "ps"; }
+  static constexpr double to_si_factor() { return 1e-12; }
+  using si_ratio = std::ratio<1, 1000000000000>;
 };
 template <> struct UnitTraits<NanosecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_NANOSECOND; }
   static constexpr std::string_view symbol() { return "ns"; }
+  static constexpr double to_si_factor() { return 1e-9; }
+  using si_ratio = std::ratio<1, 1000000000>;
 };
 template <> struct UnitTraits<MicrosecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROSECOND; }
   static constexpr std::string_view symbol() { return "µs"; }
+  static constexpr double to_si_factor() { return 1e-6; }
+  using si_ratio = std::ratio<1, 1000000>;
 };
 template <> struct UnitTraits<MillisecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLISECOND; }
   static constexpr std::string_view symbol() { return "ms"; }
+  static constexpr double to_si_factor() { return 1e-3; }
+  using si_ratio = std::ratio<1, 1000>;
 };
 template <> struct UnitTraits<CentisecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_CENTISECOND; }
   static constexpr std::string_view symbol() { return "cs"; }
+  static constexpr double to_si_factor() { return 1e-2; }
+  using si_ratio = std::ratio<1, 100>;
 };
 template <> struct UnitTraits<DecisecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_DECISECOND; }
   static constexpr std::string_view symbol() { return "ds"; }
+  static constexpr double to_si_factor() { return 1e-1; }
+  using si_ratio = std::ratio<1, 10>;
 };
 template <> struct UnitTraits<SecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_SECOND; }
   static constexpr std::string_view symbol() { return "s"; }
+  static constexpr double to_si_factor() { return 1e0; }
+  using si_ratio = std::ratio<1, 1>;
 };
 template <> struct UnitTraits<DecasecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_DECASECOND; }
   static constexpr std::string_view symbol() { return "das"; }
+  static constexpr double to_si_factor() { return 1e1; }
+  using si_ratio = std::ratio<10, 1>;
 };
 template <> struct UnitTraits<HectosecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_HECTOSECOND; }
   static constexpr std::string_view symbol() { return "hs"; }
+  static constexpr double to_si_factor() { return 1e2; }
+  using si_ratio = std::ratio<100, 1>;
 };
 template <> struct UnitTraits<KilosecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOSECOND; }
   static constexpr std::string_view symbol() { return "ks"; }
+  static constexpr double to_si_factor() { return 1e3; }
+  using si_ratio = std::ratio<1000, 1>;
 };
 template <> struct UnitTraits<MegasecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGASECOND; }
   static constexpr std::string_view symbol() { return "Ms"; }
+  static constexpr double to_si_factor() { return 1e6; }
+  using si_ratio = std::ratio<1000000, 1>;
 };
 template <> struct UnitTraits<GigasecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_GIGASECOND; }
   static constexpr std::string_view symbol() { return "Gs"; }
+  static constexpr double to_si_factor() { return 1e9; }
+  using si_ratio = std::ratio<1000000000, 1>;
 };
 template <> struct UnitTraits<TerasecondTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_TERASECOND; }
   static constexpr std::string_view symbol() { return "Ts"; }
+  static constexpr double to_si_factor() { return 1e12; }
+  using si_ratio = std::ratio<1000000000000, 1>;
 };
 template <> struct UnitTraits<MinuteTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_MINUTE; }
   static constexpr std::string_view symbol() { return "min"; }
+  static constexpr double to_si_factor() { return 6e1; }
+  using si_ratio = std::ratio<60, 1>;
 };
 template <> struct UnitTraits<HourTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_HOUR; }
   static constexpr std::string_view symbol() { return "h"; }
+  static constexpr double to_si_factor() { return 3.6e3; }
+  using si_ratio = std::ratio<3600, 1>;
 };
 template <> struct UnitTraits<DayTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_DAY; }
   static constexpr std::string_view symbol() { return "d"; }
+  static constexpr double to_si_factor() { return 8.64e4; }
+  using si_ratio = std::ratio<86400, 1>;
 };
 template <> struct UnitTraits<WeekTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_WEEK; }
   static constexpr std::string_view symbol() { return "wk"; }
+  static constexpr double to_si_factor() { return 6.048e5; }
+  using si_ratio = std::ratio<604800, 1>;
 };
 template <> struct UnitTraits<FortnightTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_FORTNIGHT; }
   static constexpr std::string_view symbol() { return "fn"; }
+  static constexpr double to_si_factor() { return 1.2096e6; }
+  using si_ratio = std::ratio<1209600, 1>;
 };
 template <> struct UnitTraits<YearTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_YEAR; }
   static constexpr std::string_view symbol() { return "yr"; }
+  static constexpr double to_si_factor() { return 3.1556952e7; }
+  using si_ratio = std::ratio<31556952, 1>;
 };
 template <> struct UnitTraits<DecadeTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_DECADE; }
   static constexpr std::string_view symbol() { return "dec"; }
+  static constexpr double to_si_factor() { return 3.1556952e8; }
+  using si_ratio = std::ratio<315569520, 1>;
 };
 template <> struct UnitTraits<CenturyTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_CENTURY; }
   static constexpr std::string_view symbol() { return "c"; }
+  static constexpr double to_si_factor() { return 3.1556952e9; }
+  using si_ratio = std::ratio<3155695200, 1>;
 };
 template <> struct UnitTraits<MillenniumTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLENNIUM; }
   static constexpr std::string_view symbol() { return "mill"; }
+  static constexpr double to_si_factor() { return 3.1556952e10; }
+  using si_ratio = std::ratio<31556952000, 1>;
 };
 template <> struct UnitTraits<JulianYearTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_JULIAN_YEAR; }
   static constexpr std::string_view symbol() { return "a"; }
+  static constexpr double to_si_factor() { return 3.15576e7; }
+  using si_ratio = std::ratio<31557600, 1>;
 };
 template <> struct UnitTraits<JulianCenturyTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_JULIAN_CENTURY; }
   static constexpr std::string_view symbol() { return "JC"; }
+  static constexpr double to_si_factor() { return 3.15576e9; }
+  using si_ratio = std::ratio<3155760000, 1>;
 };
 template <> struct UnitTraits<SiderealDayTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_SIDEREAL_DAY; }
   static constexpr std::string_view symbol() { return "sd"; }
+  static constexpr double to_si_factor() { return 8.61640905e4; }
+  using si_ratio = std::ratio<172328181, 2000>;
 };
 template <> struct UnitTraits<SynodicMonthTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_SYNODIC_MONTH; }
   static constexpr std::string_view symbol() { return "synmo"; }
+  static constexpr double to_si_factor() { return 2.5514428768992e6; }
+  using si_ratio = std::ratio<797325899031, 312500>;
 };
 template <> struct UnitTraits<SiderealYearTag> {
+  using dimension = dim::Time;
   static constexpr UnitId unit_id() { return UNIT_ID_SIDEREAL_YEAR; }
   static constexpr std::string_view symbol() { return "syr"; }
+  static constexpr double to_si_factor() { return 3.15581497635456e7; }
+  using si_ratio = std::ratio<2465480450277, 78125>;
 };
 
 using Attosecond = Quantity<AttosecondTag>;
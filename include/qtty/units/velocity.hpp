@@ -33,9 +33,10 @@ using Velocity = Quantity<CompoundTag<typename LengthUnit::unit_tag, typename Ti
 // ============================================================================
 // Division Operator: Create Compound Units
 // ============================================================================
-// Dividing a length quantity by a time quantity produces a velocity.
-// The resulting type encodes both the numerator and denominator units,
-// allowing type-safe operations on velocities while maintaining dimensional
+// Dividing a length quantity by a time quantity produces a velocity through
+// the generic quantity quotient in ffi_core.hpp ("Dimensional Algebra"). The
+// resulting type encodes both the numerator and denominator units, allowing
+// type-safe operations on velocities while maintaining dimensional
 // correctness (e.g., you can't add m/s to m/s² by accident).
 //
 // Example:
@@ -43,13 +44,7 @@ using Velocity = Quantity<CompoundTag<typename LengthUnit::unit_tag, typename Ti
 //   Second time(20.0);
 //   auto velocity = distance / time;  // Type: MeterPerSecond
 //   std::cout << velocity.value();    // Prints: 5.0
-
-// Division operator to create velocity from length and time
-template <typename LengthTag, typename TimeTag>
-Quantity<CompoundTag<LengthTag, TimeTag>> operator/(const Quantity<LengthTag> &length,
-                                                    const Quantity<TimeTag> &time) {
-  return Quantity<CompoundTag<LengthTag, TimeTag>>(length.value() / time.value());
-}
+//   auto back = velocity * time;      // Type: Meter
 
 // ============================================================================
 // UnitTraits for Compound Units
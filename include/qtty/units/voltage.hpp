@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -14,24 +15,34 @@ struct KilovoltTag {};
 struct MegavoltTag {};
 
 template <> struct UnitTraits<VoltTag> {
+  using dimension = dim::Voltage;
   static constexpr UnitId unit_id() { return UNIT_ID_VOLT; }
   static constexpr std::string_view symbol() { return "V"; }
+  static constexpr double to_si_factor() { return 1e0; }
 };
 template <> struct UnitTraits<MicrovoltTag> {
+  using dimension = dim::Voltage;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROVOLT; }
   static constexpr std::string_view symbol() { return "µV"; }
+  static constexpr double to_si_factor() { return 1e-6; }
 };
 template <> struct UnitTraits<MillivoltTag> {
+  using dimension = dim::Voltage;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLIVOLT; }
   static constexpr std::string_view symbol() { return "mV"; }
+  static constexpr double to_si_factor() { return 1e-3; }
 };
 template <> struct UnitTraits<KilovoltTag> {
+  using dimension = dim::Voltage;
   static constexpr UnitId unit_id() { return UNIT_ID_KILOVOLT; }
   static constexpr std::string_view symbol() { return "kV"; }
+  static constexpr double to_si_factor() { return 1e3; }
 };
 template <> struct UnitTraits<MegavoltTag> {
+  using dimension = dim::Voltage;
   static constexpr UnitId unit_id() { return UNIT_ID_MEGAVOLT; }
   static constexpr std::string_view symbol() { return "MV"; }
+  static constexpr double to_si_factor() { return 1e6; }
 };
 
 using Volt = Quantity<VoltTag>;
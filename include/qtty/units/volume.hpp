@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../dimensions.hpp"
 #include "../ffi_core.hpp"
 
 namespace qtty {
@@ -22,56 +23,95 @@ struct UsGallonTag {};
 struct UsFluidOunceTag {};
 
 template <> struct UnitTraits<CubicMeterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_CUBIC_METER; }
   static constexpr std::string_view symbol() { return "m³"; }
+  static constexpr double to_si_factor() { return 1e0; }
+  using si_ratio = std::ratio<1, 1>;
 };
 template <> struct UnitTraits<CubicKilometerTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_CUBIC_KILOMETER; }
   static constexpr std::string_view symbol() { return "km³"; }
+  static constexpr double to_si_factor() { return 1e9; }
+  using si_ratio = std::ratio<1000000000, 1>;
 };
 template <> struct UnitTraits<CubicCentimeterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_CUBIC_CENTIMETER; }
   static constexpr std::string_view symbol() { return "cm³"; }
+  static constexpr double to_si_factor() { return 1e-6; }
+  using si_ratio = std::ratio<1, 1000000>;
 };
 template <> struct UnitTraits<CubicMillimeterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_CUBIC_MILLIMETER; }
   static constexpr std::string_view symbol() { return "mm³"; }
+  static constexpr double to_si_factor() { return 1e-9; }
+  using si_ratio = std::ratio<1, 1000000000>;
 };
 template <> struct UnitTraits<LiterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_LITER; }
   static constexpr std::string_view symbol() { return "L"; }
+  static constexpr double to_si_factor() { return 1e-3; }
+  using si_ratio = std::ratio<1, 1000>;
 };
 template <> struct UnitTraits<MilliliterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_MILLILITER; }
   static constexpr std::string_view symbol() { return "mL"; }
+  static constexpr double to_si_factor() { return 1e-6; }
+  using si_ratio = std::ratio<1, 1000000>;
 };
 template <> struct UnitTraits<MicroliterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_MICROLITER; }
   static constexpr std::string_view symbol() { return "µL"; }
+  static constexpr double to_si_factor() { return 1e-9; }
+  using si_ratio = std::ratio<1, 1000000000>;
 };
 template <> struct UnitTraits<CentiliterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_CENTILITER; }
   static constexpr std::string_view symbol() { return "cL"; }
+  static constexpr double to_si_factor() { return 1e-5; }
+  using si_ratio = std::ratio<1, 100000>;
 };
 template <> struct UnitTraits<DeciliterTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_DECILITER; }
   static constexpr std::string_view symbol() { return "dL"; }
+  static constexpr double to_si_factor() { return 1e-4; }
+  using si_ratio = std::ratio<1, 10000>;
 };
 template <> struct UnitTraits<CubicInchTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_CUBIC_INCH; }
   static constexpr std::string_view symbol() { return "in³"; }
+  static constexpr double to_si_factor() { return 1.6387064e-5; }
+  using si_ratio = std::ratio<2048383, 125000000000>;
 };
 template <> struct UnitTraits<CubicFootTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_CUBIC_FOOT; }
   static constexpr std::string_view symbol() { return "ft³"; }
+  static constexpr double to_si_factor() { return 2.8316846592e-2; }
+  using si_ratio = std::ratio<55306341, 1953125000>;
 };
 template <> struct UnitTraits<UsGallonTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_US_GALLON; }
   static constexpr std::string_view symbol() { return "gal"; }
+  static constexpr double to_si_factor() { return 3.785411784e-3; }
+  using si_ratio = std::ratio<473176473, 125000000000>;
 };
 template <> struct UnitTraits<UsFluidOunceTag> {
+  using dimension = dim::Volume;
   static constexpr UnitId unit_id() { return UNIT_ID_US_FLUID_OUNCE; }
   static constexpr std::string_view symbol() { return "fl oz"; }
+  static constexpr double to_si_factor() { return 2.95735295625e-5; }
+  using si_ratio = std::ratio<473176473, 16000000000000>;
 };
 
 using CubicMeter = Quantity<CubicMeterTag>;
@@ -0,0 +1,391 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#pragma once
+
+/**
+ * @file views.hpp
+ * @brief Lazy unit-conversion views over contiguous quantities.
+ *
+ * `views::as<Target>(values)` does not convert anything: it returns a
+ * ScaledView that remembers the source buffer and the compile-time factor
+ * into `Target`. Chained views fold into one factor, and the factor is
+ * applied only by the consumer (a reduction, a copy into an output buffer,
+ * or an element read), so no intermediate column is written:
+ *
+ * @code
+ * qtty::QuantityArray<qtty::KilometerTag> km = load();
+ * auto au = qtty::views::as<qtty::AstronomicalUnit>(qtty::views::as<qtty::Meter>(km));
+ * qtty::AstronomicalUnit farthest = qtty::max(au); // one pass, one multiply
+ * @endcode
+ *
+ * In C++20 the header also provides `std::ranges` adaptors that convert,
+ * strip or attach units element by element inside a pipeline:
+ *
+ * @code
+ * auto km = readings | std::views::filter(valid) | qtty::views::convert<qtty::Kilometer>;
+ * @endcode
+ */
+
+#include "ffi_core.hpp"
+#include "quantity_array.hpp"
+#include "quantity_span.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+namespace qtty {
+
+/**
+ * @brief Read-only view of `SourceTag` values seen in `TargetTag`.
+ *
+ * Holds a ConstQuantitySpan of the source and the compile-time factor
+ * `SourceTag` → `TargetTag`; the source must outlive the view. Elements are
+ * produced by value, scaled on the fly. Only unit pairs with a compile-time
+ * factor can be viewed.
+ */
+template <typename SourceTag, typename TargetTag, typename Rep = double> class ScaledView {
+  static_assert(has_static_conversion<SourceTag, TargetTag>() ||
+                    std::is_same_v<SourceTag, TargetTag>,
+                "Lazy views need a compile-time conversion factor");
+
+public:
+  using source_tag = SourceTag;
+  using unit_tag = TargetTag;
+  using rep = Rep;
+  using value_type = Quantity<TargetTag, Rep>;
+  using size_type = std::size_t;
+
+  /// Pending factor from `SourceTag` into `TargetTag`.
+  static constexpr double factor = detail::static_conversion_factor<SourceTag, TargetTag>();
+
+  constexpr ScaledView() noexcept = default;
+  constexpr explicit ScaledView(ConstQuantitySpan<SourceTag, Rep> source) noexcept
+      : m_source(source) {}
+
+  /// The unconverted source values.
+  constexpr ConstQuantitySpan<SourceTag, Rep> source() const noexcept { return m_source; }
+
+  constexpr size_type size() const noexcept { return m_source.size(); }
+  constexpr bool empty() const noexcept { return m_source.empty(); }
+
+  /// Element @p index, converted.
+  constexpr value_type operator[](size_type index) const noexcept {
+    return value_type(scale(m_source[index].value()));
+  }
+
+  /// Scale one raw source value into `TargetTag`.
+  static constexpr Rep scale(Rep value) noexcept {
+    if constexpr (std::is_same_v<SourceTag, TargetTag>) {
+      return value;
+    } else {
+      return detail::to_rep<Rep>(static_cast<detail::compute_t<Rep>>(value) * factor);
+    }
+  }
+
+  /**
+   * @brief Random-access iterator yielding converted quantities by value.
+   *
+   * Like the iterators of `std::views::transform`, it is a C++17 input
+   * iterator that models `std::random_access_iterator` in C++20.
+   */
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+#if __cplusplus >= 202002L
+    using iterator_concept = std::random_access_iterator_tag;
+#endif
+    using value_type = Quantity<TargetTag, Rep>;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type;
+    using pointer = void;
+
+    constexpr iterator() noexcept = default;
+    constexpr explicit iterator(const Quantity<SourceTag, Rep> *position) noexcept
+        : m_position(position) {}
+
+    constexpr value_type operator*() const noexcept {
+      return value_type(ScaledView::scale(m_position->value()));
+    }
+    constexpr value_type operator[](difference_type offset) const noexcept {
+      return *(*this + offset);
+    }
+
+    constexpr iterator &operator++() noexcept {
+      ++m_position;
+      return *this;
+    }
+    constexpr iterator operator++(int) noexcept {
+      iterator old = *this;
+      ++m_position;
+      return old;
+    }
+    constexpr iterator &operator--() noexcept {
+      --m_position;
+      return *this;
+    }
+    constexpr iterator operator--(int) noexcept {
+      iterator old = *this;
+      --m_position;
+      return old;
+    }
+    constexpr iterator &operator+=(difference_type offset) noexcept {
+      m_position += offset;
+      return *this;
+    }
+    constexpr iterator &operator-=(difference_type offset) noexcept {
+      m_position -= offset;
+      return *this;
+    }
+
+    friend constexpr iterator operator+(iterator it, difference_type offset) noexcept {
+      return it += offset;
+    }
+    friend constexpr iterator operator+(difference_type offset, iterator it) noexcept {
+      return it += offset;
+    }
+    friend constexpr iterator operator-(iterator it, difference_type offset) noexcept {
+      return it -= offset;
+    }
+    friend constexpr difference_type operator-(iterator lhs, iterator rhs) noexcept {
+      return lhs.m_position - rhs.m_position;
+    }
+
+    friend constexpr bool operator==(iterator lhs, iterator rhs) noexcept {
+      return lhs.m_position == rhs.m_position;
+    }
+    friend constexpr bool operator!=(iterator lhs, iterator rhs) noexcept {
+      return lhs.m_position != rhs.m_position;
+    }
+    friend constexpr bool operator<(iterator lhs, iterator rhs) noexcept {
+      return lhs.m_position < rhs.m_position;
+    }
+    friend constexpr bool operator>(iterator lhs, iterator rhs) noexcept {
+      return lhs.m_position > rhs.m_position;
+    }
+    friend constexpr bool operator<=(iterator lhs, iterator rhs) noexcept {
+      return lhs.m_position <= rhs.m_position;
+    }
+    friend constexpr bool operator>=(iterator lhs, iterator rhs) noexcept {
+      return lhs.m_position >= rhs.m_position;
+    }
+
+  private:
+    const Quantity<SourceTag, Rep> *m_position = nullptr;
+  };
+
+  constexpr iterator begin() const noexcept { return iterator(m_source.begin()); }
+  constexpr iterator end() const noexcept { return iterator(m_source.end()); }
+
+  /// Materialize the converted values (one pass over the source).
+  QuantityArray<TargetTag, Rep> to_array() const {
+    QuantityArray<TargetTag, Rep> out(size());
+    detail::convert_values<SourceTag, TargetTag>(m_source.raw_data(), out.data(), size());
+    return out;
+  }
+
+private:
+  ConstQuantitySpan<SourceTag, Rep> m_source;
+};
+
+namespace views {
+
+/**
+ * @brief Lazily view @p source in `TargetType` (a tag or Quantity type).
+ *
+ * Accepts a QuantitySpan, a QuantityArray, a `std::vector` of quantities or
+ * another ScaledView; viewing a ScaledView composes the two conversions
+ * into the single factor `SourceTag` → `TargetType`.
+ */
+template <typename TargetType, typename SourceTag, typename Rep>
+constexpr ScaledView<SourceTag, typename ExtractTag<TargetType>::type, std::remove_const_t<Rep>>
+as(QuantitySpan<SourceTag, Rep> source) noexcept {
+  using R = std::remove_const_t<Rep>;
+  return ScaledView<SourceTag, typename ExtractTag<TargetType>::type, R>(
+      ConstQuantitySpan<SourceTag, R>(source));
+}
+
+template <typename TargetType, typename SourceTag, typename Rep, typename Allocator>
+ScaledView<SourceTag, typename ExtractTag<TargetType>::type, Rep>
+as(const QuantityArray<SourceTag, Rep, Allocator> &source) noexcept {
+  return as<TargetType>(source.span());
+}
+
+template <typename TargetType, typename SourceTag, typename Rep, typename Allocator>
+ScaledView<SourceTag, typename ExtractTag<TargetType>::type, Rep>
+as(const std::vector<Quantity<SourceTag, Rep>, Allocator> &source) noexcept {
+  return as<TargetType>(ConstQuantitySpan<SourceTag, Rep>(source));
+}
+
+// A view over a temporary container would dangle once the statement ends.
+template <typename TargetType, typename SourceTag, typename Rep, typename Allocator>
+void as(QuantityArray<SourceTag, Rep, Allocator> &&source) = delete;
+
+template <typename TargetType, typename SourceTag, typename Rep, typename Allocator>
+void as(std::vector<Quantity<SourceTag, Rep>, Allocator> &&source) = delete;
+
+template <typename TargetType, typename SourceTag, typename ViewTag, typename Rep>
+constexpr ScaledView<SourceTag, typename ExtractTag<TargetType>::type, Rep>
+as(const ScaledView<SourceTag, ViewTag, Rep> &view) noexcept {
+  static_assert(dimensions_compatible<ViewTag, typename ExtractTag<TargetType>::type>(),
+                "Cannot convert between units of different dimensions");
+  return ScaledView<SourceTag, typename ExtractTag<TargetType>::type, Rep>(view.source());
+}
+
+} // namespace views
+
+#if __cplusplus >= 202002L
+// ============================================================================
+// Range Adaptors (C++20)
+// ============================================================================
+// Each adaptor is a std::views::transform with a stateless element function,
+// so a conversion with a compile-time factor inlines to one multiply per
+// element of the surrounding pipeline. Adaptors compose with `|` into a single
+// transform (`convert<Kilometer> | values` reads each element once).
+
+namespace detail {
+
+template <typename TargetTag> struct ConvertElement {
+  template <typename Q>
+    requires requires(const Q &q) { q.template to<TargetTag>(); }
+  constexpr auto operator()(const Q &q) const {
+    return q.template to<TargetTag>();
+  }
+};
+
+struct ValueOfElement {
+  template <typename Q>
+    requires requires(const Q &q) { q.value(); }
+  constexpr auto operator()(const Q &q) const noexcept {
+    return q.value();
+  }
+};
+
+template <typename UnitTag> struct TagElement {
+  template <typename Rep>
+    requires std::is_arithmetic_v<Rep>
+  constexpr Quantity<UnitTag, Rep> operator()(Rep value) const noexcept {
+    return Quantity<UnitTag, Rep>(value);
+  }
+};
+
+// Element function applying First, then Second
+template <typename First, typename Second> struct ComposedElement {
+  template <typename T>
+    requires std::invocable<const First &, T> &&
+             std::invocable<const Second &, std::invoke_result_t<const First &, T>>
+  constexpr auto operator()(T &&element) const {
+    return Second{}(First{}(std::forward<T>(element)));
+  }
+};
+
+// Range adaptor closure: `range | closure` and `closure(range)` apply
+// std::views::transform(range, ElementFn{}).
+template <typename ElementFn> struct TransformClosure {
+  template <std::ranges::viewable_range R>
+    requires std::regular_invocable<const ElementFn &, std::ranges::range_reference_t<R>>
+  constexpr auto operator()(R &&range) const {
+    return std::views::transform(std::forward<R>(range), ElementFn{});
+  }
+
+  template <std::ranges::viewable_range R>
+    requires std::regular_invocable<const ElementFn &, std::ranges::range_reference_t<R>>
+  friend constexpr auto operator|(R &&range, TransformClosure closure) {
+    return closure(std::forward<R>(range));
+  }
+
+  template <typename NextFn>
+  friend constexpr TransformClosure<ComposedElement<ElementFn, NextFn>>
+  operator|(TransformClosure, TransformClosure<NextFn>) noexcept {
+    return {};
+  }
+};
+
+} // namespace detail
+
+namespace views {
+
+/// Convert each quantity to `TargetType` (a tag or Quantity type).
+template <typename TargetType>
+inline constexpr detail::TransformClosure<
+    detail::ConvertElement<typename ExtractTag<TargetType>::type>>
+    convert{};
+
+/// Project each quantity to its raw value.
+inline constexpr detail::TransformClosure<detail::ValueOfElement> values{};
+
+/// Lift each raw value to a quantity of `UnitType` (a tag or Quantity type),
+/// keeping the value's representation.
+template <typename UnitType>
+inline constexpr detail::TransformClosure<detail::TagElement<typename ExtractTag<UnitType>::type>>
+    tag{};
+
+} // namespace views
+#endif // __cplusplus >= 202002L
+
+// ============================================================================
+// Consuming Scaled Views
+// ============================================================================
+// Static conversion factors are positive, so the extremes of the source are
+// the extremes of the view: min() and max() scan the raw values and scale
+// only the result, and sum() scales only the total. Copies are one pass of
+// the batch kernels.
+
+template <typename SourceTag, typename TargetTag, typename Rep>
+Quantity<TargetTag, Rep> sum(const ScaledView<SourceTag, TargetTag, Rep> &view) noexcept {
+  using View = ScaledView<SourceTag, TargetTag, Rep>;
+  const Rep *raw = view.source().raw_data();
+  detail::accumulate_t<Rep> total = 0;
+  for (std::size_t i = 0; i < view.size(); ++i) {
+    total += raw[i];
+  }
+  if constexpr (std::is_same_v<SourceTag, TargetTag>) {
+    return Quantity<TargetTag, Rep>(detail::to_rep<Rep>(total));
+  } else {
+    return Quantity<TargetTag, Rep>(
+        detail::to_rep<Rep>(static_cast<detail::compute_t<Rep>>(total) * View::factor));
+  }
+}
+
+template <typename SourceTag, typename TargetTag, typename Rep>
+Quantity<TargetTag, Rep> min(const ScaledView<SourceTag, TargetTag, Rep> &view) noexcept {
+  return Quantity<TargetTag, Rep>(view.scale(qtty::min(view.source()).value()));
+}
+
+template <typename SourceTag, typename TargetTag, typename Rep>
+Quantity<TargetTag, Rep> max(const ScaledView<SourceTag, TargetTag, Rep> &view) noexcept {
+  return Quantity<TargetTag, Rep>(view.scale(qtty::max(view.source()).value()));
+}
+
+/**
+ * @brief Write the converted values of @p in into @p out.
+ *
+ * @p out may use any unit statically convertible from the source; the view
+ * and output conversions fold into one factor.
+ *
+ * @throws QttyException when the sizes differ.
+ */
+template <typename SourceTag, typename TargetTag, typename OutTag, typename Rep>
+void convert_batch(const ScaledView<SourceTag, TargetTag, Rep> &in, QuantitySpan<OutTag, Rep> out) {
+  static_assert(dimensions_compatible<TargetTag, OutTag>(),
+                "Cannot convert between units of different dimensions");
+  detail::check_same_size(in.size(), out.size(), "convert_batch");
+  detail::convert_values<SourceTag, OutTag>(in.source().raw_data(), out.raw_data(), in.size());
+}
+
+} // namespace qtty
+
+#if __cplusplus >= 202002L
+// Scaled views are cheap, non-owning views over external storage.
+namespace std::ranges {
+template <typename SourceTag, typename TargetTag, typename Rep>
+inline constexpr bool enable_view<qtty::ScaledView<SourceTag, TargetTag, Rep>> = true;
+template <typename SourceTag, typename TargetTag, typename Rep>
+inline constexpr bool enable_borrowed_range<qtty::ScaledView<SourceTag, TargetTag, Rep>> = true;
+} // namespace std::ranges
+#endif // __cplusplus >= 202002L
@@ -25,3 +25,21 @@ class DerivedQuantityTest : public QttyTest {};
 class QuantityOperationsTest : public QttyTest {};
 class DimensionSafetyTest : public QttyTest {};
 class PrecisionEdgeCaseTest : public QttyTest {};
+class StaticConversionTest : public QttyTest {};
+class ConversionCacheTest : public QttyTest {};
+class BatchConversionTest : public QttyTest {};
+class SimdKernelTest : public QttyTest {};
+class NonThrowingTest : public QttyTest {};
+class ConverterTest : public QttyTest {};
+class MixedUnitTest : public QttyTest {};
+class UnitAlgebraTest : public QttyTest {};
+class RepresentationTest : public QttyTest {};
+class QuantityArrayTest : public QttyTest {};
+class QuantitySpanTest : public QttyTest {};
+class ScaledViewTest : public QttyTest {};
+class RangeAdaptorTest : public QttyTest {};
+class ArrayExprTest : public QttyTest {};
+class ParallelTest : public QttyTest {};
+class ReduceTest : public QttyTest {};
+class BinaryFormatTest : public QttyTest {};
+class QcolFileTest : public QttyTest {};
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Compile-only check: the headers and the non-throwing API must build with
+// -fno-exceptions. Not linked into any executable.
+
+#include "qtty/qtty.hpp"
+#include "qtty/serialization.hpp"
+
+#include <cmath>
+
+namespace {
+
+[[maybe_unused]] double kilometers_or_nan(double meters) {
+  auto km = qtty::Meter(meters).try_to<qtty::Kilometer>();
+  return km ? km->value() : std::nan("");
+}
+
+[[maybe_unused]] QttyStatus runtime_status(UnitId from, UnitId to) {
+  return qtty::try_convert_value(1.0, from, to).status();
+}
+
+[[maybe_unused]] std::size_t formatted_length(const qtty::Second &s) {
+  auto text = s.try_format(3);
+  return text ? text->size() : 0;
+}
+
+[[maybe_unused]] double parse_or_zero(std::string_view json) {
+  return qtty::serialization::try_from_json<qtty::Meter>(json).value_or(qtty::Meter(0.0)).value();
+}
+
+} // namespace
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <vector>
+
+using KilometerPerSecond = Quantity<CompoundTag<KilometerTag, SecondTag>>;
+
+// Element types follow the scalar Quantity algebra (so `meters + seconds` is a
+// compile error).
+using Lengths = QuantityArray<KilometerTag>;
+using Durations = QuantityArray<SecondTag>;
+static_assert(std::is_same_v<decltype(std::declval<Lengths &>() / std::declval<Durations &>())::
+                                 value_type,
+                             KilometerPerSecond>);
+static_assert(std::is_same_v<decltype(std::declval<Lengths &>() + Meter(1.0))::value_type, Meter>);
+static_assert(std::is_convertible_v<decltype(std::declval<Lengths &>() * 2.0), Lengths>);
+static_assert(!std::is_convertible_v<decltype(std::declval<Lengths &>() * 2.0),
+                                     QuantityArray<MeterTag>>);
+static_assert(std::is_constructible_v<QuantityArray<MeterTag>,
+                                      decltype(std::declval<Lengths &>() * 2.0)>);
+
+TEST_F(ArrayExprTest, FusesPositionUpdate) {
+  QuantityArray<KilometerTag> pos{Kilometer(1.0), Kilometer(2.0), Kilometer(3.0)};
+  QuantityArray<CompoundTag<KilometerTag, SecondTag>> vel{
+      KilometerPerSecond(0.5), KilometerPerSecond(-1.0), KilometerPerSecond(2.0)};
+  const QuantityArray<SecondTag> dt{Second(2.0), Second(2.0), Second(0.5)};
+
+  QuantityArray<KilometerTag> next = pos + vel * dt;
+  EXPECT_EQ(next[0], Kilometer(2.0));
+  EXPECT_EQ(next[1], Kilometer(0.0));
+  EXPECT_EQ(next[2], Kilometer(4.0));
+
+  // A single step size broadcasts, and minutes cancel the seconds of km/s.
+  pos += vel * Minute(1.0);
+  EXPECT_EQ(pos[0], Kilometer(31.0));
+
+  // Assigning an expression that reads the destination is evaluated in place.
+  const double *buffer = pos.data();
+  pos = pos - vel * Minute(1.0);
+  EXPECT_EQ(pos.data(), buffer);
+  EXPECT_EQ(pos[0], Kilometer(1.0));
+}
+
+TEST_F(ArrayExprTest, QuotientsAreCompoundUnits) {
+  const QuantityArray<MeterTag> distance{Meter(100.0), Meter(30.0)};
+  const QuantityArray<SecondTag> time{Second(10.0), Second(3.0)};
+  auto speed = evaluate(distance / time);
+  static_assert(std::is_same_v<decltype(speed), QuantityArray<CompoundTag<MeterTag, SecondTag>>>);
+  EXPECT_EQ(speed[1].value(), 10.0);
+
+  const QuantityArray<CompoundTag<KilometerTag, HourTag>> kmh(distance / time);
+  EXPECT_DOUBLE_EQ(kmh[0].value(), 36.0);
+
+  // Dimensionless quotients are plain numbers.
+  EXPECT_EQ((distance / distance)[0], 1.0);
+}
+
+TEST_F(ArrayExprTest, MixedUnitsAndSpans) {
+  std::vector<double> raw_cm{50.0, 25.0};
+  const QuantitySpan<CentimeterTag> cm(raw_cm.data(), raw_cm.size());
+  const QuantityArray<MeterTag> m{Meter(1.0), Meter(2.0)};
+
+  const QuantityArray<CentimeterTag> total = m + cm;
+  EXPECT_EQ(total[0], Centimeter(150.0));
+
+  std::vector<double> out(2);
+  evaluate((m - cm) * 2.0, QuantitySpan<MillimeterTag>(out.data(), out.size()));
+  EXPECT_EQ(out, (std::vector<double>{1000.0, 3500.0}));
+}
+
+TEST_F(ArrayExprTest, TemporariesAndSizes) {
+  const QuantityArray<MeterTag> a{Meter(1.0), Meter(2.0)};
+  auto expr = QuantityArray<MeterTag>{Meter(10.0), Meter(20.0)} + a; // owns the temporary
+  EXPECT_EQ(evaluate(expr)[1], Meter(22.0));
+
+  const QuantityArray<MeterTag> shorter(1);
+  EXPECT_THROW(a + shorter, QttyException);
+
+  QuantityArray<MeterTag> out;
+  out = a * 3.0;
+  EXPECT_EQ(out.size(), 2u);
+  EXPECT_EQ(out[1], Meter(6.0));
+}
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+#include <type_traits>
+#include <vector>
+
+// Typed batch conversions check the dimension at compile time, like to<>().
+template <typename From, typename To, typename = void>
+struct BatchConvertible : std::false_type {};
+template <typename From, typename To>
+struct BatchConvertible<From, To,
+                        std::void_t<decltype(convert_batch<From, To>(
+                            std::declval<const double *>(), std::declval<double *>(), 0))>>
+    : std::true_type {};
+static_assert(BatchConvertible<Meter, Kilometer>::value);
+static_assert(BatchConvertible<MeterPerSecond, KilometerPerHour>::value);
+static_assert(!BatchConvertible<Meter, Second>::value);
+static_assert(!BatchConvertible<MeterTag, MeterPerSecond>::value);
+
+TEST_F(BatchConversionTest, StaticFactorBuffer) {
+  const std::vector<double> km{0.0, 1.0, 149597870.7, -2.5};
+  std::vector<double> au(km.size());
+  convert_batch<Kilometer, AstronomicalUnit>(km.data(), au.data(), km.size());
+  for (std::size_t i = 0; i < km.size(); ++i) {
+    EXPECT_EQ(au[i], Kilometer(km[i]).to<AstronomicalUnit>().value());
+  }
+  EXPECT_NEAR(au[2], 1.0, 1e-12);
+}
+
+TEST_F(BatchConversionTest, InPlace) {
+  std::vector<double> values{1.0, 2.0, 3.0};
+  convert_batch<HourTag, MinuteTag>(values.data(), values.size());
+  EXPECT_EQ(values, (std::vector<double>{60.0, 120.0, 180.0}));
+}
+
+TEST_F(BatchConversionTest, RuntimeUnitIds) {
+  const std::vector<double> in{1.0, 10.0};
+  std::vector<double> out(in.size());
+  convert_batch(UNIT_ID_MILE, UNIT_ID_KILOMETER, in.data(), out.data(), in.size());
+  EXPECT_NEAR(out[0], 1.609344, 1e-12);
+  EXPECT_NEAR(out[1], 16.09344, 1e-12);
+
+  EXPECT_THROW(convert_batch(UNIT_ID_MILE, UNIT_ID_SECOND, in.data(), out.data(), in.size()),
+               IncompatibleDimensionsError);
+}
+
+TEST_F(BatchConversionTest, CompoundUnits) {
+  std::vector<double> values{100.0, 25.0};
+  convert_batch<MeterPerSecond, KilometerPerHour>(values.data(), values.size());
+  EXPECT_NEAR(values[0], 360.0, 1e-9);
+  EXPECT_NEAR(values[1], 90.0, 1e-9);
+}
+
+TEST_F(BatchConversionTest, EmptyBuffer) {
+  double *none = nullptr;
+  convert_batch<Meter, Kilometer>(none, none, 0);
+  convert_batch(UNIT_ID_METER, UNIT_ID_KILOMETER, none, 0);
+}
+
+TEST_F(BatchConversionTest, SinglePrecisionBuffers) {
+  std::vector<float> values(37);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(i) * 0.5f;
+  }
+  std::vector<float> km(values.size());
+  convert_batch<Meter, Kilometer>(values.data(), km.data(), values.size());
+  convert_batch(UNIT_ID_KILOMETER, UNIT_ID_METER, km.data(), km.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_FLOAT_EQ(km[i], values[i]);
+  }
+}
+
+#if __cplusplus >= 202002L
+TEST_F(BatchConversionTest, SpanOverloads) {
+  const std::vector<double> in{1000.0, 2000.0};
+  std::vector<double> out(in.size());
+  convert_batch<Meter, Kilometer>(std::span<const double>(in), std::span<double>(out));
+  EXPECT_EQ(out, (std::vector<double>{1.0, 2.0}));
+
+  convert_batch<Kilometer, Meter>(std::span<double>(out));
+  EXPECT_EQ(out, in);
+
+  std::vector<double> too_small(1);
+  EXPECT_THROW(convert_batch(UNIT_ID_METER, UNIT_ID_KILOMETER, std::span<const double>(in),
+                             std::span<double>(too_small)),
+               QttyException);
+}
+#endif
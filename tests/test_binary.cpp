@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using KilometerPerHour = Quantity<CompoundTag<KilometerTag, HourTag>>;
+using MeterPerSecond = Quantity<CompoundTag<MeterTag, SecondTag>>;
+
+std::uint32_t u32_at(const std::vector<std::byte> &bytes, std::size_t offset) {
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    value |= static_cast<std::uint32_t>(bytes[offset + i]) << (8 * i);
+  }
+  return value;
+}
+
+} // namespace
+
+TEST_F(BinaryFormatTest, ValueRoundTrip) {
+  const std::vector<std::byte> wire = binary::encode(Kilometer(1.5));
+  ASSERT_EQ(wire.size(), binary::kValueHeaderSize + sizeof(double));
+  EXPECT_EQ(wire[0], std::byte{'Q'});
+  EXPECT_EQ(wire[1], std::byte{'B'});
+  EXPECT_EQ(wire[2], std::byte{binary::kFormatVersion});
+  EXPECT_EQ(wire[3], std::byte{0});
+  EXPECT_EQ(u32_at(wire, 4), static_cast<std::uint32_t>(UNIT_ID_KILOMETER));
+  EXPECT_EQ(u32_at(wire, 8), static_cast<std::uint32_t>(binary::kNoUnit));
+
+  EXPECT_EQ(binary::decode<Kilometer>(wire.data(), wire.size()).value(), 1.5);
+  EXPECT_DOUBLE_EQ(binary::decode<Meter>(wire.data(), wire.size()).value(), 1500.0);
+
+  // float values travel as f32 and widen on request
+  std::byte small[binary::kValueHeaderSize + sizeof(float)];
+  const Quantity<SecondTag, float> t(0.25f);
+  EXPECT_EQ(binary::encode_into(t, small, sizeof(small)), sizeof(small));
+  EXPECT_EQ(small[3], std::byte{1});
+  EXPECT_EQ(binary::decode<Millisecond>(small, sizeof(small)).value(), 250.0);
+  EXPECT_EQ(binary::try_encode_into(t, small, sizeof(small) - 1).status(),
+            QTTY_STATUS_BUFFER_TOO_SMALL);
+}
+
+TEST_F(BinaryFormatTest, ArraysDecodeInPlaceOrConverted) {
+  QuantityArray<KilometerTag> km(1000);
+  for (std::size_t i = 0; i < km.size(); ++i) {
+    km.set(i, Kilometer(0.5 * static_cast<double>(i)));
+  }
+  std::vector<std::byte> wire(binary::encoded_size(km.span()));
+  ASSERT_EQ(binary::encode_into(km.span(), wire.data(), wire.size()), wire.size());
+  EXPECT_EQ(wire[3], std::byte{2});
+
+  const auto header = binary::try_read_header(wire.data(), wire.size());
+  ASSERT_TRUE(header);
+  EXPECT_TRUE(header->array);
+  EXPECT_EQ(header->count, km.size());
+  EXPECT_EQ(header->size(), wire.size());
+
+  const auto view = binary::decode_view<Kilometer>(wire.data(), wire.size());
+  EXPECT_EQ(static_cast<const void *>(view.raw_data()), wire.data() + binary::kArrayHeaderSize);
+  EXPECT_EQ(view[999], Kilometer(499.5));
+
+  const auto meters = binary::decode_array<Meter>(wire.data(), wire.size());
+  ASSERT_EQ(meters.size(), km.size());
+  EXPECT_DOUBLE_EQ(meters[3].value(), 1500.0);
+
+  // Other units, precision or a misaligned payload need a copy
+  EXPECT_EQ(binary::try_decode_view<Meter>(wire.data(), wire.size()).status(), kStatusNotViewable);
+  EXPECT_EQ(binary::try_decode_view<Second>(wire.data(), wire.size()).status(),
+            QTTY_STATUS_INCOMPATIBLE_DIM);
+  using FloatKilometer = Quantity<KilometerTag, float>;
+  EXPECT_EQ(binary::try_decode_view<FloatKilometer>(wire.data(), wire.size()).status(),
+            kStatusNotViewable);
+  EXPECT_EQ(binary::decode_array<FloatKilometer>(wire.data(), wire.size())[7].value(), 3.5f);
+  std::vector<std::byte> shifted(wire.size() + 1);
+  std::memcpy(shifted.data() + 1, wire.data(), wire.size());
+  EXPECT_EQ(binary::try_decode_view<Kilometer>(shifted.data() + 1, wire.size()).status(),
+            kStatusNotViewable);
+  EXPECT_EQ(binary::decode_array<Kilometer>(shifted.data() + 1, wire.size())[999].value(), 499.5);
+
+  const auto empty = binary::encode(QuantityArray<MeterTag>().span());
+  EXPECT_TRUE(binary::decode_array<Meter>(empty.data(), empty.size()).empty());
+}
+
+TEST_F(BinaryFormatTest, CompoundHeaders) {
+  const std::vector<std::byte> wire = binary::encode(KilometerPerHour(36.0));
+  EXPECT_EQ(u32_at(wire, 4), static_cast<std::uint32_t>(UNIT_ID_KILOMETER));
+  EXPECT_EQ(u32_at(wire, 8), static_cast<std::uint32_t>(UNIT_ID_HOUR));
+  EXPECT_DOUBLE_EQ(binary::decode<MeterPerSecond>(wire.data(), wire.size()).value(), 10.0);
+  EXPECT_EQ(binary::try_decode<Meter>(wire.data(), wire.size()).status(),
+            QTTY_STATUS_INCOMPATIBLE_DIM);
+
+  const QuantityArray<MeterPerSecond::unit_tag> speeds(4, MeterPerSecond(5.0));
+  const auto array = binary::encode(speeds.span());
+  EXPECT_DOUBLE_EQ(binary::decode_array<KilometerPerHour>(array.data(), array.size())[3].value(),
+                   18.0);
+  EXPECT_EQ(binary::decode_view<MeterPerSecond>(array.data(), array.size()).size(), 4u);
+  EXPECT_EQ(binary::try_decode_array<Second>(array.data(), array.size()).status(),
+            QTTY_STATUS_INCOMPATIBLE_DIM);
+}
+
+TEST_F(BinaryFormatTest, RejectsMalformedRecords) {
+  const QuantityArray<MeterTag> values(3, Meter(1.0));
+  const std::vector<std::byte> wire = binary::encode(values.span());
+  const std::byte *data = wire.data();
+
+  EXPECT_EQ(binary::try_decode_array<Meter>(data, wire.size() - 1).status(),
+            QTTY_STATUS_BUFFER_TOO_SMALL);
+  EXPECT_EQ(binary::try_read_header(data, 5).status(), QTTY_STATUS_BUFFER_TOO_SMALL);
+  EXPECT_EQ(binary::try_decode<Meter>(data, wire.size()).status(), kStatusMalformedInput);
+
+  std::vector<std::byte> bad = wire;
+  bad[0] = std::byte{'X'};
+  EXPECT_EQ(binary::try_read_header(bad.data(), bad.size()).status(), kStatusMalformedInput);
+  bad = wire;
+  bad[2] = std::byte{binary::kFormatVersion + 1};
+  EXPECT_EQ(binary::try_read_header(bad.data(), bad.size()).status(), kStatusMalformedInput);
+  bad = wire;
+  bad[3] |= std::byte{0x80};
+  EXPECT_EQ(binary::try_read_header(bad.data(), bad.size()).status(), kStatusMalformedInput);
+  bad = wire;
+  bad[23] = std::byte{0xff}; // count near 2^64
+  EXPECT_EQ(binary::try_read_header(bad.data(), bad.size()).status(),
+            QTTY_STATUS_BUFFER_TOO_SMALL);
+
+  EXPECT_THROW(binary::decode_array<Meter>(bad.data(), bad.size()), QttyException);
+  EXPECT_THROW(binary::decode_view<Meter>(data, 3), QttyException);
+}
+
+TEST_F(BinaryFormatTest, ByteSwapPath) {
+  const double values[2] = {1.0, -2.5};
+  double swapped[2];
+  detail::byteswap_copy<std::uint64_t>(swapped, values, 2);
+  const auto *in = reinterpret_cast<const unsigned char *>(values);
+  const auto *out = reinterpret_cast<const unsigned char *>(swapped);
+  for (std::size_t i = 0; i < sizeof(double); ++i) {
+    EXPECT_EQ(out[i], in[sizeof(double) - 1 - i]);
+    EXPECT_EQ(out[8 + i], in[2 * sizeof(double) - 1 - i]);
+  }
+  double restored[2];
+  detail::byteswap_copy<std::uint64_t>(restored, swapped, 2);
+  EXPECT_EQ(restored[0], 1.0);
+  EXPECT_EQ(restored[1], -2.5);
+  EXPECT_EQ(detail::byteswap<std::uint32_t>(0x01020304u), 0x04030201u);
+}
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+#include <thread>
+#include <vector>
+
+// Tags without `to_si_factor()` force the FFI path, as happens with headers
+// built against a newer qtty-ffi.
+struct FfiOnlyFootTag {};
+struct FfiOnlyFathomTag {};
+
+namespace qtty {
+template <> struct UnitTraits<FfiOnlyFootTag> {
+  static constexpr UnitId unit_id() { return UNIT_ID_FOOT; }
+  static constexpr std::string_view symbol() { return "ft"; }
+};
+template <> struct UnitTraits<FfiOnlyFathomTag> {
+  static constexpr UnitId unit_id() { return UNIT_ID_FATHOM; }
+  static constexpr std::string_view symbol() { return "ftm"; }
+};
+} // namespace qtty
+
+static_assert(!has_static_conversion<FfiOnlyFootTag, MeterTag>());
+
+TEST_F(ConversionCacheTest, FirstConversionPopulatesCache) {
+  double factor = 0.0;
+  EXPECT_FALSE(detail::conversion_cache_lookup(UNIT_ID_FOOT, UNIT_ID_YARD, factor));
+
+  Quantity<FfiOnlyFootTag> ft(3.0);
+  EXPECT_NEAR(ft.to<Yard>().value(), 1.0, 1e-12);
+
+  ASSERT_TRUE(detail::conversion_cache_lookup(UNIT_ID_FOOT, UNIT_ID_YARD, factor));
+  EXPECT_NEAR(factor, 1.0 / 3.0, 1e-15);
+  EXPECT_NEAR(ft.to<Yard>().value(), 1.0, 1e-12);
+}
+
+TEST_F(ConversionCacheTest, ConvertValueMatchesStaticPath) {
+  EXPECT_DOUBLE_EQ(convert_value(2.5, UNIT_ID_KILOMETER, UNIT_ID_MILE),
+                   Kilometer(2.5).to<Mile>().value());
+  EXPECT_DOUBLE_EQ(convert_value(2.5, UNIT_ID_KILOMETER, UNIT_ID_MILE),
+                   Kilometer(2.5).to<Mile>().value());
+}
+
+TEST_F(ConversionCacheTest, ErrorsAreNotCached) {
+  EXPECT_THROW(convert_value(1.0, UNIT_ID_METER, UNIT_ID_SECOND), IncompatibleDimensionsError);
+  double factor = 0.0;
+  EXPECT_FALSE(detail::conversion_cache_lookup(UNIT_ID_METER, UNIT_ID_SECOND, factor));
+  EXPECT_THROW(convert_value(1.0, UNIT_ID_METER, UNIT_ID_SECOND), IncompatibleDimensionsError);
+}
+
+TEST_F(ConversionCacheTest, ConcurrentReadersAgree) {
+  constexpr int kThreads = 8;
+  constexpr int kIterations = 10000;
+  std::vector<double> results(kThreads, 0.0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([t, &results] {
+      double acc = 0.0;
+      for (int i = 0; i < kIterations; ++i) {
+        acc += Quantity<FfiOnlyFathomTag>(1.0).to<Meter>().value();
+      }
+      results[t] = acc;
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (double r : results) {
+    EXPECT_NEAR(r, kIterations * 1.8288, 1e-6);
+  }
+}
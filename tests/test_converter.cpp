@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+#include <vector>
+
+// Typed plans with generated factors are built at compile time.
+static_assert(Converter<Kilometer, Meter>()(1.5) == 1500.0);
+static_assert(Converter<MeterTag, MeterTag>().is_identity());
+static_assert(Converter<MeterPerSecond, KilometerPerHour>()(MeterPerSecond(10.0)).value() ==
+              MeterPerSecond(10.0).to<KilometerPerHour>().value());
+
+TEST_F(ConverterTest, RuntimePairMatchesConvertValue) {
+  const Converter<> plan(UNIT_ID_MILE, UNIT_ID_KILOMETER);
+  EXPECT_EQ(plan.from(), UNIT_ID_MILE);
+  EXPECT_EQ(plan.to(), UNIT_ID_KILOMETER);
+  EXPECT_EQ(plan.kind(), Converter<>::Kind::Linear);
+  EXPECT_EQ(plan.offset(), 0.0);
+  for (double v : {0.0, -1.0, 3.5, 1e12}) {
+    EXPECT_EQ(plan(v), convert_value(v, UNIT_ID_MILE, UNIT_ID_KILOMETER));
+  }
+}
+
+TEST_F(ConverterTest, IdentityPlan) {
+  const Converter<> plan(UNIT_ID_SECOND, UNIT_ID_SECOND);
+  EXPECT_TRUE(plan.is_identity());
+  EXPECT_EQ(plan(-0.0), -0.0);
+  EXPECT_TRUE(std::signbit(plan(-0.0)));
+
+  std::vector<double> in{1.0, 2.0};
+  std::vector<double> out(2);
+  plan(in.data(), out.data(), in.size());
+  EXPECT_EQ(out, in);
+}
+
+TEST_F(ConverterTest, BufferOverloads) {
+  const Converter<> plan(UNIT_ID_HOUR, UNIT_ID_MINUTE);
+  std::vector<double> values(41);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<double>(i);
+  }
+  std::vector<double> out(values.size());
+  plan(values.data(), out.data(), values.size());
+  plan(values.data(), values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(out[i], 60.0 * static_cast<double>(i));
+    EXPECT_EQ(values[i], out[i]);
+  }
+}
+
+TEST_F(ConverterTest, TypedQuantityOverload) {
+  const Converter<AstronomicalUnit, Kilometer> plan;
+  const Kilometer km = plan(AstronomicalUnit(1.0));
+  EXPECT_EQ(km.value(), AstronomicalUnit(1.0).to<Kilometer>().value());
+  EXPECT_EQ(plan(2.0), km.value() * 2.0);
+}
+
+TEST_F(ConverterTest, InvalidPairReportsStatus) {
+  EXPECT_THROW(Converter<>(UNIT_ID_METER, UNIT_ID_SECOND), IncompatibleDimensionsError);
+  auto plan = Converter<>::try_make(UNIT_ID_METER, UNIT_ID_SECOND);
+  EXPECT_FALSE(plan);
+  EXPECT_EQ(plan.status(), QTTY_STATUS_INCOMPATIBLE_DIM);
+}
+
+#if __cplusplus >= 202002L
+TEST_F(ConverterTest, SpanOverloads) {
+  const Converter<> plan(UNIT_ID_KILOMETER, UNIT_ID_METER);
+  std::vector<double> in{1.0, 2.5};
+  std::vector<double> out(in.size());
+  plan(std::span<const double>(in), std::span<double>(out));
+  EXPECT_EQ(out, (std::vector<double>{1000.0, 2500.0}));
+  plan(std::span<double>(in));
+  EXPECT_EQ(in, out);
+
+  std::vector<double> small(1);
+  EXPECT_THROW(plan(std::span<const double>(in), std::span<double>(small)), QttyException);
+}
+#endif
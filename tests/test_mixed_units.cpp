@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+// Mixed-unit results are expressed in the finer unit, at compile time.
+static_assert(std::is_same_v<common_unit_t<KilometerTag, MeterTag>, MeterTag>);
+static_assert(std::is_same_v<common_unit_t<MeterTag, KilometerTag>, MeterTag>);
+static_assert(std::is_same_v<decltype(1.0_km + 250.0_m), Meter>);
+static_assert((1.0_km + 250.0_m).value() == 1250.0);
+static_assert((1.0_h - 30.0_min).value() == 30.0);
+static_assert(500.0_m < 1.0_km);
+static_assert(1.0_km == 1000.0_m);
+static_assert(noexcept(std::declval<const Kilometer &>() + std::declval<const Meter &>()));
+
+TEST_F(MixedUnitTest, AdditionUsesFinerUnit) {
+  const auto total = Kilometer(2.0) + Meter(500.0);
+  static_assert(std::is_same_v<decltype(total), const Meter>);
+  EXPECT_DOUBLE_EQ(total.value(), 2500.0);
+
+  const auto elapsed = Hour(1.0) + Second(30.0);
+  static_assert(std::is_same_v<decltype(elapsed), const Second>);
+  EXPECT_DOUBLE_EQ(elapsed.value(), 3630.0);
+
+  EXPECT_DOUBLE_EQ((Meter(250.0) - Kilometer(1.0)).value(), -750.0);
+}
+
+TEST_F(MixedUnitTest, Comparisons) {
+  const Meter distance(1500.0);
+  const Kilometer limit(2.0);
+  EXPECT_TRUE(distance < limit);
+  EXPECT_TRUE(distance <= limit);
+  EXPECT_FALSE(distance > limit);
+  EXPECT_FALSE(distance >= limit);
+  EXPECT_TRUE(limit > distance);
+  EXPECT_TRUE(distance != limit);
+  EXPECT_TRUE(Kilometer(1.5) == distance);
+  EXPECT_TRUE(Minute(60.0) == Hour(1.0));
+}
+
+TEST_F(MixedUnitTest, CompoundAssignmentKeepsLeftUnit) {
+  Kilometer route(1.0);
+  route += Meter(250.0);
+  EXPECT_DOUBLE_EQ(route.value(), 1.25);
+  route -= Meter(1250.0);
+  EXPECT_DOUBLE_EQ(route.value(), 0.0);
+}
+
+TEST_F(MixedUnitTest, CompoundUnits) {
+  const auto sum = MeterPerSecond(10.0) + KilometerPerHour(36.0);
+  static_assert(std::is_same_v<decltype(sum), const KilometerPerHour>);
+  EXPECT_DOUBLE_EQ(sum.value(), 72.0);
+  EXPECT_TRUE(MeterPerSecond(10.0) > KilometerPerHour(35.0));
+}
+
+TEST_F(MixedUnitTest, MatchesExplicitConversion) {
+  const Parsec pc(1.0);
+  const LightYear ly(1.0);
+  const auto sum = pc + ly;
+  static_assert(std::is_same_v<decltype(sum), const LightYear>);
+  EXPECT_DOUBLE_EQ(sum.value(), pc.to<LightYear>().value() + ly.value());
+}
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Several chunks plus a partial one.
+constexpr std::size_t kCount = 3 * detail::kParallelChunk + 123;
+
+QuantityArray<KilometerTag> make_distances() {
+  QuantityArray<KilometerTag> km(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    km.set(i, Kilometer(0.1 * static_cast<double>(i % 977) - 3.3));
+  }
+  return km;
+}
+
+} // namespace
+
+static_assert(is_execution_policy_v<execution::parallel_policy>);
+static_assert(!is_execution_policy_v<double>);
+
+TEST_F(ParallelTest, ConversionMatchesSequential) {
+  const QuantityArray<KilometerTag> km = make_distances();
+  QuantityArray<MeterTag> expected(kCount);
+  convert_batch(km.span(), expected.span());
+
+  for (unsigned threads : {1u, 2u, 5u}) {
+    QuantityArray<MeterTag> out(kCount);
+    convert_batch(execution::parallel_policy{threads}, km.span(), out.span());
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+  }
+
+  QuantityArray<KilometerTag> in_place = km;
+  QuantitySpan<MeterTag> m = convert_batch<Meter>(execution::par, in_place.span());
+  EXPECT_EQ(m.data(), reinterpret_cast<Meter *>(in_place.data()));
+  EXPECT_EQ(m[kCount - 1], expected[kCount - 1]);
+
+  QuantityArray<MeterTag> too_small(1);
+  EXPECT_THROW(convert_batch(execution::par, km.span(), too_small.span()), QttyException);
+}
+
+TEST_F(ParallelTest, ExpressionsMatchSequential) {
+  const QuantityArray<KilometerTag> km = make_distances();
+  const QuantityArray<SecondTag> s(kCount, Second(4.0));
+  const QuantityArray<CompoundTag<KilometerTag, SecondTag>> expected = km / s;
+
+  auto speed = evaluate(execution::parallel_policy{3}, km / s);
+  static_assert(std::is_same_v<decltype(speed), decltype(evaluate(km / s))>);
+  EXPECT_TRUE(std::equal(speed.begin(), speed.end(), expected.begin()));
+
+  QuantityArray<MeterTag> m(kCount);
+  evaluate(execution::par, km + Meter(1.0), m.span());
+  EXPECT_EQ(m[1], km[1] + Meter(1.0));
+}
+
+TEST_F(ParallelTest, ReductionsAreDeterministic) {
+  const QuantityArray<KilometerTag> km = make_distances();
+  const Kilometer reference = sum(execution::parallel_policy{1}, km.span());
+  for (unsigned threads : {2u, 3u, 8u}) {
+    EXPECT_EQ(sum(execution::parallel_policy{threads}, km.span()).value(), reference.value());
+  }
+  EXPECT_NEAR(reference.value(), km.sum().value(), 1e-6);
+#if QTTY_HAS_STD_EXECUTION
+  EXPECT_EQ(sum(std::execution::seq, km.span()).value(), reference.value());
+#endif
+
+  EXPECT_EQ(qtty::min(execution::par, km.span()), km.min());
+  EXPECT_EQ(qtty::max(execution::par, km.span()), km.max());
+  EXPECT_EQ(sum(execution::par, ConstQuantitySpan<MeterTag>()), Meter(0.0));
+  EXPECT_THROW(qtty::min(execution::par, ConstQuantitySpan<MeterTag>()), QttyException);
+  EXPECT_THROW(qtty::max(execution::seq, QuantitySpan<MeterTag>()), QttyException);
+
+  std::vector<std::int64_t> counts(kCount, 3);
+  const QuantitySpan<SecondTag, std::int64_t> ticks(counts.data(), counts.size());
+  EXPECT_EQ(sum(execution::par, ticks).value(), static_cast<std::int64_t>(3 * kCount));
+}
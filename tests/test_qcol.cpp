@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+#include "qtty/qcol.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+using MeterPerSecond = Quantity<CompoundTag<MeterTag, SecondTag>>;
+using KilometerPerHour = Quantity<CompoundTag<KilometerTag, HourTag>>;
+using FloatSecond = Quantity<SecondTag, float>;
+using Ticks = Quantity<SecondTag, std::int64_t>;
+
+std::string temp_path(const char *name) { return ::testing::TempDir() + name; }
+
+std::vector<char> read_bytes(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+void write_bytes(const std::string &path, const std::vector<char> &bytes) {
+  std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size());
+}
+
+// range (km, double), epoch (s, float), speed (m/s), ticks (s, int64)
+std::string write_table(const char *name) {
+  QuantityArray<KilometerTag> range(10000);
+  QuantityArray<SecondTag, float> epoch(10000);
+  for (std::size_t i = 0; i < range.size(); ++i) {
+    range.set(i, Kilometer(0.25 * static_cast<double>(i)));
+    epoch.set(i, FloatSecond(static_cast<float>(i)));
+  }
+  const QuantityArray<MeterPerSecond::unit_tag> speed(3, MeterPerSecond(5.0));
+  const QuantityArray<SecondTag, std::int64_t> ticks = {Ticks(7)};
+
+  qcol::Writer writer;
+  writer.add("range", range.span());
+  writer.add("epoch", epoch.span());
+  writer.add("speed", speed.span());
+  writer.add("ticks", ticks.span());
+  const std::string path = temp_path(name);
+  writer.write(path);
+  return path;
+}
+
+} // namespace
+
+TEST_F(QcolFileTest, ViewsColumnsInPlace) {
+  const qcol::File file = qcol::File::open(write_table("view.qcol"));
+  ASSERT_EQ(file.size(), 4u);
+  EXPECT_EQ(file.verify(), QTTY_STATUS_OK);
+
+  const qcol::ColumnInfo range = file.column(0);
+  EXPECT_EQ(range.name, "range");
+  EXPECT_EQ(range.unit, UNIT_ID_KILOMETER);
+  EXPECT_EQ(range.denominator, binary::kNoUnit);
+  EXPECT_EQ(range.rep, qcol::RepType::F64);
+  EXPECT_EQ(range.alignment, qcol::kColumnAlignment);
+  EXPECT_EQ(range.length, 10000u);
+  EXPECT_EQ(file.column(2).denominator, UNIT_ID_SECOND);
+
+  const ConstQuantitySpan<KilometerTag> km = file.view<Kilometer>("range");
+  ASSERT_EQ(km.size(), 10000u);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(km.raw_data()) % qcol::kColumnAlignment, 0u);
+  EXPECT_EQ(km[9999], Kilometer(2499.75));
+  EXPECT_EQ(file.view<FloatSecond>("epoch")[42].value(), 42.0f);
+  EXPECT_EQ(file.view<MeterPerSecond>("speed")[2], MeterPerSecond(5.0));
+  EXPECT_EQ(file.view<Ticks>("ticks")[0].value(), 7);
+
+  // Views survive moving the file
+  qcol::File moved = qcol::File::open(write_table("moved.qcol"));
+  const auto before = moved.view<Kilometer>("range");
+  const qcol::File owner = std::move(moved);
+  EXPECT_EQ(before[4], Kilometer(1.0));
+  EXPECT_EQ(owner.view<Kilometer>("range").raw_data(), before.raw_data());
+}
+
+TEST_F(QcolFileTest, ConvertsOnlyWhenUnitsDiffer) {
+  const qcol::File file = qcol::File::open(write_table("convert.qcol"));
+
+  EXPECT_EQ(file.try_view<Meter>("range").status(), kStatusNotViewable);
+  EXPECT_EQ(file.try_view<Second>("range").status(), QTTY_STATUS_INCOMPATIBLE_DIM);
+  EXPECT_EQ(file.try_view<Second>("epoch").status(), kStatusNotViewable); // float stored
+
+  const QuantityArray<MeterTag> m = file.load<Meter>("range");
+  ASSERT_EQ(m.size(), 10000u);
+  EXPECT_DOUBLE_EQ(m[4].value(), 1000.0);
+  const auto lazy = views::as<Meter>(file.view<Kilometer>("range"));
+  EXPECT_DOUBLE_EQ(lazy[4].value(), 1000.0);
+
+  EXPECT_EQ(file.load<Second>("epoch")[3].value(), 3.0);
+  EXPECT_DOUBLE_EQ(file.load<KilometerPerHour>("speed")[0].value(), 18.0);
+  EXPECT_EQ(file.load<Millisecond>("ticks")[0].value(), 7000.0);
+  EXPECT_EQ(file.try_load<Meter>("speed").status(), QTTY_STATUS_INCOMPATIBLE_DIM);
+}
+
+TEST_F(QcolFileTest, RejectsMissingAndCorruptFiles) {
+  EXPECT_EQ(qcol::File::try_open(temp_path("absent.qcol").c_str()).status(), kStatusIoError);
+  EXPECT_THROW(qcol::File::open(temp_path("absent.qcol")), QttyException);
+
+  const std::string path = write_table("corrupt.qcol");
+  const std::vector<char> good = read_bytes(path);
+  EXPECT_EQ(qcol::File::open(path).try_find("missing").status(), kStatusNotFound);
+  EXPECT_THROW(qcol::File::open(path).view<Meter>("missing"), QttyException);
+
+  std::vector<char> bad = good;
+  bad[0] = 'X';
+  write_bytes(path, bad);
+  EXPECT_EQ(qcol::File::try_open(path.c_str()).status(), kStatusMalformedInput);
+
+  bad = good;
+  bad[32 + 40] ^= 1; // length of the first column
+  write_bytes(path, bad);
+  EXPECT_EQ(qcol::File::try_open(path.c_str()).status(), kStatusMalformedInput);
+
+  bad = good;
+  bad.resize(bad.size() - 8); // last column cut short
+  write_bytes(path, bad);
+  EXPECT_EQ(qcol::File::try_open(path.c_str()).status(), kStatusMalformedInput);
+
+  bad = good;
+  bad[4] = static_cast<char>(qcol::kFormatVersion - 1);
+  write_bytes(path, bad);
+  EXPECT_EQ(qcol::File::try_open(path.c_str()).status(), kStatusMalformedInput);
+
+  bad = good;
+  bad.back() ^= 1; // a value: opens, but fails verification
+  write_bytes(path, bad);
+  const auto opened = qcol::File::try_open(path.c_str());
+  ASSERT_TRUE(opened);
+  EXPECT_EQ(opened->verify(), kStatusMalformedInput);
+
+  // Flipped sign bits do not cancel out
+  const double values[4] = {1.5, -2.0, 3.25, 4.0};
+  const double flipped[4] = {-1.5, -2.0, -3.25, 4.0};
+  EXPECT_NE(detail::qcol_checksum_host<8>(values, 4), detail::qcol_checksum_host<8>(flipped, 4));
+
+  qcol::Writer writer;
+  EXPECT_THROW(writer.add(std::string(qcol::kMaxNameLength + 1, 'x'),
+                          QuantityArray<MeterTag>().span()),
+               QttyException);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <cstdint>
+#include <vector>
+
+static_assert(std::is_same_v<QuantityArray<MeterTag>::value_type, Meter>);
+static_assert(
+    std::is_same_v<decltype(std::declval<QuantityArray<KilometerTag, float>>().to<Meter>()),
+                   QuantityArray<MeterTag, float>>);
+
+TEST_F(QuantityArrayTest, StorageIsAligned) {
+  QuantityArray<MeterTag> meters(37, Meter(1.5));
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(meters.data()) % kDefaultAlignment, 0u);
+  EXPECT_EQ(meters.size(), 37u);
+  EXPECT_EQ(meters[36], Meter(1.5));
+
+  meters.push_back(Meter(2.0));
+  meters.set(0, Meter(-1.0));
+  EXPECT_EQ(meters[0], Meter(-1.0));
+  EXPECT_EQ(meters[37], Meter(2.0));
+}
+
+TEST_F(QuantityArrayTest, ConvertMatchesScalarConversion) {
+  const QuantityArray<KilometerTag> km{Kilometer(0.0), Kilometer(1.5), Kilometer(149597870.7)};
+  const QuantityArray<AstronomicalUnitTag> au = km.to<AstronomicalUnit>();
+  ASSERT_EQ(au.size(), km.size());
+  for (std::size_t i = 0; i < km.size(); ++i) {
+    EXPECT_EQ(au[i], km[i].to<AstronomicalUnit>());
+  }
+  EXPECT_EQ(km[1], Kilometer(1.5)); // the source is untouched
+}
+
+TEST_F(QuantityArrayTest, RvalueConversionReusesBuffer) {
+  QuantityArray<HourTag> hours{Hour(1.0), Hour(2.0)};
+  const double *buffer = hours.data();
+  QuantityArray<MinuteTag> minutes = std::move(hours).to<Minute>();
+  EXPECT_EQ(minutes.data(), buffer);
+  EXPECT_EQ(minutes[1], Minute(120.0));
+}
+
+TEST_F(QuantityArrayTest, OtherRepresentations) {
+  QuantityArray<MillimeterTag, int32_t> mm{Quantity<MillimeterTag, int32_t>(1499),
+                                           Quantity<MillimeterTag, int32_t>(2500)};
+  const auto m = mm.to<Meter>();
+  EXPECT_EQ(m[0].value(), 1);
+  EXPECT_EQ(m[1].value(), 3);
+  EXPECT_EQ(mm.sum().value(), 3999);
+
+  QuantityArray<KilometerTag, float> km(4, Quantity<KilometerTag, float>(0.25f));
+  EXPECT_FLOAT_EQ(km.to<Meter>()[3].value(), 250.0f);
+  EXPECT_FLOAT_EQ(km.sum().value(), 1.0f);
+}
+
+TEST_F(QuantityArrayTest, Arithmetic) {
+  QuantityArray<MeterTag> a{Meter(1.0), Meter(2.0), Meter(3.0)};
+  const QuantityArray<MeterTag> b{Meter(10.0), Meter(20.0), Meter(30.0)};
+
+  const auto sum = a + b;
+  EXPECT_EQ(sum[2], Meter(33.0));
+  EXPECT_EQ((b - a)[0], Meter(9.0));
+  EXPECT_EQ((a * 2.0)[1], Meter(4.0));
+  EXPECT_EQ((2.0 * a)[1], Meter(4.0));
+  EXPECT_EQ((b / 10.0)[2], Meter(3.0));
+
+  a += QuantityArray<KilometerTag>(3, Kilometer(0.5));
+  EXPECT_EQ(a[0], Meter(501.0));
+
+  const QuantityArray<MeterTag> shorter(2);
+  EXPECT_THROW(a += shorter, QttyException);
+}
+
+TEST_F(QuantityArrayTest, FromRawValues) {
+  const std::vector<double> raw{1.0, 2.0};
+  const QuantityArray<MeterTag> m(raw.data(), raw.size());
+  EXPECT_EQ(m.to<Kilometer>()[1], Kilometer(0.002));
+}
+
+TEST_F(QuantityArrayTest, Reductions) {
+  const QuantityArray<SecondTag> s{Second(4.0), Second(-1.5), Second(9.0), Second(0.5)};
+  EXPECT_EQ(s.sum(), Second(12.0));
+  EXPECT_EQ(s.min(), Second(-1.5));
+  EXPECT_EQ(s.max(), Second(9.0));
+  EXPECT_EQ(QuantityArray<SecondTag>().sum(), Second(0.0));
+}
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <algorithm>
+#include <vector>
+
+// Views rely on a Quantity being exactly its value.
+static_assert(is_value_layout_v<MeterTag, double>);
+static_assert(is_value_layout_v<CompoundTag<KilometerTag, HourTag>, float>);
+static_assert(std::is_convertible_v<QuantitySpan<MeterTag>, ConstQuantitySpan<MeterTag>>);
+static_assert(!std::is_convertible_v<ConstQuantitySpan<MeterTag>, QuantitySpan<MeterTag>>);
+static_assert(!std::is_constructible_v<QuantitySpan<MeterTag>, QuantityArray<KilometerTag> &>);
+static_assert(!std::is_constructible_v<QuantitySpan<MeterTag>, const QuantityArray<MeterTag> &>);
+
+TEST_F(QuantitySpanTest, ViewsRawBufferWithoutCopy) {
+  std::vector<double> raw{1.0, 2.5, -4.0};
+  QuantitySpan<KilometerTag> km(raw.data(), raw.size());
+  ASSERT_EQ(km.size(), 3u);
+  EXPECT_EQ(km[1], Kilometer(2.5));
+
+  km[0] = Kilometer(7.0);
+  km[2] += Meter(500.0);
+  EXPECT_EQ(raw[0], 7.0);
+  EXPECT_EQ(raw[2], -3.5);
+
+  std::sort(km.begin(), km.end());
+  EXPECT_EQ(raw, (std::vector<double>{-3.5, 2.5, 7.0}));
+}
+
+TEST_F(QuantitySpanTest, ViewsContainers) {
+  std::vector<Meter> meters{Meter(1.0), Meter(2.0)};
+  ConstQuantitySpan<MeterTag> view = meters;
+  EXPECT_EQ(view.back(), Meter(2.0));
+  EXPECT_EQ(view.data(), meters.data());
+
+  QuantityArray<SecondTag> seconds{Second(3.0), Second(4.0), Second(5.0)};
+  QuantitySpan<SecondTag> s = seconds;
+  s[1] = Second(40.0);
+  EXPECT_EQ(seconds[1], Second(40.0));
+  EXPECT_EQ(s.subspan(1).size(), 2u);
+  EXPECT_EQ(s.first(1).back(), Second(3.0));
+  EXPECT_EQ(s.last(1).front(), Second(5.0));
+}
+
+TEST_F(QuantitySpanTest, BatchConversion) {
+  const std::vector<double> raw{1.0, 2.0};
+  std::vector<double> out(raw.size());
+  convert_batch(ConstQuantitySpan<HourTag>(raw.data(), raw.size()),
+                QuantitySpan<MinuteTag>(out.data(), out.size()));
+  EXPECT_EQ(out, (std::vector<double>{60.0, 120.0}));
+
+  std::vector<double> too_small(1);
+  EXPECT_THROW(convert_batch(ConstQuantitySpan<HourTag>(raw.data(), raw.size()),
+                             QuantitySpan<MinuteTag>(too_small.data(), too_small.size())),
+               QttyException);
+
+  std::vector<float> data{1.5f, 3.0f};
+  const QuantitySpan<MeterTag, float> m =
+      convert_batch<Meter>(QuantitySpan<KilometerTag, float>(data.data(), data.size()));
+  EXPECT_FLOAT_EQ(m[0].value(), 1500.0f);
+  EXPECT_FLOAT_EQ(data[1], 3000.0f);
+
+  constexpr Converter<Meter, Centimeter> m_to_cm;
+  std::vector<Centimeter> cm(2);
+  const std::vector<Meter> lengths{Meter(1.0), Meter(0.25)};
+  m_to_cm(lengths, cm);
+  EXPECT_EQ(cm[1], Centimeter(25.0));
+}
+
+TEST_F(QuantitySpanTest, Reductions) {
+  const std::vector<double> raw{4.0, -1.5, 9.0, 0.5};
+  const ConstQuantitySpan<SecondTag> s(raw.data(), raw.size());
+  EXPECT_EQ(qtty::sum(s), Second(12.0));
+  EXPECT_EQ(qtty::min(s), Second(-1.5));
+  EXPECT_EQ(qtty::max(s), Second(9.0));
+  EXPECT_EQ(qtty::sum(ConstQuantitySpan<SecondTag>()), Second(0.0));
+}
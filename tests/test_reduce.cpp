@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Several blocks plus a partial one.
+constexpr std::size_t kCount = 3 * detail::kParallelChunk + 123;
+
+// One huge value followed by many small ones: a naive sum loses every 1.0.
+std::vector<double> ill_conditioned() {
+  std::vector<double> values(kCount, 1.0);
+  values[0] = 1e16;
+  return values;
+}
+
+} // namespace
+
+static_assert(is_execution_policy_v<execution::sequenced_policy>);
+static_assert(std::is_same_v<decltype(reduce::dot(std::declval<ConstQuantitySpan<MeterTag>>(),
+                                                  std::declval<ConstQuantitySpan<MeterTag>>())),
+                             Quantity<ProductTag<MeterTag, MeterTag>>>);
+static_assert(
+    std::is_same_v<decltype(reduce::dot(
+                       std::declval<ConstQuantitySpan<CompoundTag<KilometerTag, SecondTag>>>(),
+                       std::declval<ConstQuantitySpan<SecondTag>>())),
+                   Kilometer>);
+
+TEST_F(ReduceTest, SumIsCompensated) {
+  std::vector<double> values = ill_conditioned();
+  const ConstQuantitySpan<JouleTag> energy(values.data(), values.size());
+
+  double naive = 0.0;
+  for (double v : values) {
+    naive += v;
+  }
+  const double exact = 1e16 + static_cast<double>(kCount - 1);
+  EXPECT_NE(naive, exact);
+  EXPECT_EQ(reduce::sum(energy).value(), exact);
+  EXPECT_EQ(reduce::mean(energy).value(), exact / static_cast<double>(kCount));
+
+  EXPECT_EQ(reduce::sum(ConstQuantitySpan<JouleTag>()), Joule(0.0));
+  EXPECT_TRUE(std::isnan(reduce::mean(ConstQuantitySpan<JouleTag>()).value()));
+}
+
+TEST_F(ReduceTest, ResultsAreBitwiseReproducible) {
+  std::vector<double> values(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    values[i] = (i % 2 ? -1.0 : 1.0) * 0.1 * static_cast<double>(i % 977) + 1e-3;
+  }
+  const ConstQuantitySpan<MeterTag> x(values.data(), values.size());
+
+  const Meter total = reduce::sum(x);
+  const auto dot = reduce::dot(x, x);
+  const Meter norm = reduce::norm(x);
+  for (unsigned threads : {1u, 2u, 3u, 8u}) {
+    const execution::parallel_policy policy{threads};
+    EXPECT_EQ(reduce::sum(policy, x).value(), total.value());
+    EXPECT_EQ(reduce::dot(policy, x, x).value(), dot.value());
+    EXPECT_EQ(reduce::norm(policy, x).value(), norm.value());
+  }
+#if QTTY_HAS_STD_EXECUTION
+  EXPECT_EQ(reduce::sum(std::execution::seq, x).value(), total.value());
+#endif
+  EXPECT_DOUBLE_EQ(norm.value(), std::sqrt(dot.value()));
+}
+
+TEST_F(ReduceTest, DotProductsAreTyped) {
+  const QuantityArray<MeterTag> width = {Meter(2.0), Meter(3.0), Meter(4.0)};
+  const QuantityArray<MeterTag> height = {Meter(5.0), Meter(6.0), Meter(7.0)};
+  EXPECT_DOUBLE_EQ(reduce::dot(width.span(), height.span()).to<SquareMeter>().value(), 56.0);
+
+  using KilometerPerSecond = Quantity<CompoundTag<KilometerTag, SecondTag>>;
+  const QuantityArray<KilometerPerSecond::unit_tag> speed(3, KilometerPerSecond(1.5));
+  const QuantityArray<SecondTag> dt = {Second(1.0), Second(2.0), Second(4.0)};
+  const Kilometer travelled = reduce::dot(speed.span(), dt.span());
+  EXPECT_DOUBLE_EQ(travelled.value(), 10.5);
+
+  const QuantityArray<HertzTag> rate = {Hertz(50.0), Hertz(10.0)};
+  const QuantityArray<SecondTag> window = {Second(2.0), Second(0.5)};
+  const double cycles = reduce::dot(rate.span(), window.span());
+  EXPECT_DOUBLE_EQ(cycles, 105.0);
+
+  EXPECT_THROW(reduce::dot(width.span(), window.span()), QttyException);
+}
+
+TEST_F(ReduceTest, IntegralRepresentations) {
+  std::vector<std::int64_t> counts = {1, 2, 3, 4};
+  const QuantitySpan<SecondTag, std::int64_t> ticks(counts.data(), counts.size());
+  static_assert(std::is_same_v<decltype(reduce::sum(ticks)), Quantity<SecondTag, std::int64_t>>);
+  static_assert(std::is_same_v<decltype(reduce::mean(ticks)), Quantity<SecondTag, double>>);
+  EXPECT_EQ(reduce::sum(ticks).value(), 10);
+  EXPECT_DOUBLE_EQ(reduce::mean(ticks).value(), 2.5);
+  EXPECT_DOUBLE_EQ(reduce::norm(ticks).value(), std::sqrt(30.0));
+}
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using MeterF = Quantity<MeterTag, float>;
+using KilometerF = Quantity<KilometerTag, float>;
+using MeterL = Quantity<MeterTag, long double>;
+using MeterI32 = Quantity<MeterTag, int32_t>;
+using MeterI64 = Quantity<MeterTag, int64_t>;
+using MillimeterI32 = Quantity<MillimeterTag, int32_t>;
+
+// The value is the only member, so columns shrink with the representation.
+static_assert(sizeof(MeterF) == sizeof(float));
+static_assert(sizeof(MeterI32) == sizeof(int32_t));
+static_assert(std::is_same_v<Meter::rep, double>);
+static_assert(std::is_same_v<MeterF::rep, float>);
+
+// Widening is implicit; narrowing needs rep_cast<>() or an explicit construction.
+static_assert(std::is_convertible_v<MeterF, Meter>);
+static_assert(std::is_convertible_v<Meter, MeterL>);
+static_assert(std::is_convertible_v<MeterI32, Meter>);
+static_assert(std::is_convertible_v<MeterI32, MeterI64>);
+static_assert(!std::is_convertible_v<Meter, MeterF>);
+static_assert(!std::is_convertible_v<MeterI64, Meter>);
+static_assert(!std::is_convertible_v<Meter, MeterI32>);
+static_assert(!std::is_convertible_v<MeterI64, MeterI32>);
+static_assert(std::is_constructible_v<MeterF, Meter>);
+static_assert(std::is_constructible_v<MeterI32, Meter>);
+static_assert(!std::is_constructible_v<MeterI32, double>);
+static_assert(!std::is_convertible_v<Meter, Kilometer>);
+
+// Conversions keep the representation.
+static_assert(std::is_same_v<decltype(MeterF(1.0f).to<Kilometer>()), KilometerF>);
+static_assert(MeterI32(1500).to<Millimeter>().value() == 1500000);
+static_assert(rep_cast<int32_t>(Meter(2.5)).value() == 3);
+static_assert(rep_cast<int32_t>(Meter(-2.5)).value() == -3);
+static_assert(rep_cast<int32_t>(Meter(2.49)).value() == 2);
+
+// Mixed representations combine in their common type.
+static_assert(std::is_same_v<decltype(MeterF(1.0f) + Meter(1.0)), Meter>);
+static_assert(std::is_same_v<decltype(MeterF(1.0f) * 2.0f), MeterF>);
+static_assert(std::is_same_v<decltype(MeterF(1.0f) * 2.0), Meter>);
+static_assert(std::is_same_v<decltype(KilometerF(1.0f) + MeterF(1.0f)), MeterF>);
+static_assert(MeterI32(3) == Meter(3.0));
+static_assert(MeterI32(999) < Quantity<KilometerTag, int32_t>(1));
+
+// Scaling in place never truncates a floating scalar into an integral rep.
+template <typename Q, typename Scalar, typename = void> struct ScalesInPlace : std::false_type {};
+template <typename Q, typename Scalar>
+struct ScalesInPlace<Q, Scalar,
+                     std::void_t<decltype(std::declval<Q &>() *= std::declval<Scalar>()),
+                                 decltype(std::declval<Q &>() /= std::declval<Scalar>())>>
+    : std::true_type {};
+static_assert(ScalesInPlace<MeterI32, int>::value);
+static_assert(ScalesInPlace<MeterF, double>::value);
+static_assert(!ScalesInPlace<MeterI32, double>::value);
+static_assert(!ScalesInPlace<MeterI64, float>::value);
+
+TEST_F(RepresentationTest, FloatConversions) {
+  const MeterF m(1500.0f);
+  const KilometerF km = m.to<Kilometer>();
+  EXPECT_FLOAT_EQ(km.value(), 1.5f);
+  EXPECT_FLOAT_EQ(km.to<MeterTag>().value(), 1500.0f);
+
+  const Meter widened = m;
+  EXPECT_DOUBLE_EQ(widened.value(), 1500.0);
+  EXPECT_FLOAT_EQ(rep_cast<float>(1.25_km).value(), 1.25f);
+}
+
+TEST_F(RepresentationTest, IntegerRoundsToNearest) {
+  const Quantity<InchTag, int64_t> in(10);
+  EXPECT_EQ(in.to<Millimeter>().value(), 254);
+  EXPECT_EQ(MillimeterI32(1499).to<Meter>().value(), 1);
+  EXPECT_EQ(MillimeterI32(1500).to<Meter>().value(), 2);
+  EXPECT_EQ(MillimeterI32(-1500).to<Meter>().value(), -2);
+
+  MeterI64 total(0);
+  total += Quantity<KilometerTag, int32_t>(2);
+  total += MeterI32(5);
+  EXPECT_EQ(total.value(), 2005);
+
+  total *= 3;
+  total /= 2;
+  EXPECT_EQ(total.value(), 3007);
+
+  // float *= double scales in double and rounds once
+  MeterF f(3.0f);
+  f *= 0.1;
+  EXPECT_EQ(f.value(), static_cast<float>(3.0 * 0.1));
+}
+
+TEST_F(RepresentationTest, LongDoubleKeepsPrecision) {
+  const MeterL m(1.0L + std::numeric_limits<long double>::epsilon());
+  EXPECT_EQ((m - MeterL(1.0L)).value(), std::numeric_limits<long double>::epsilon());
+  static_assert(std::is_same_v<decltype(m + Meter(1.0)), MeterL>);
+  static_assert(std::is_same_v<decltype(m.to<Kilometer>())::rep, long double>);
+}
+
+TEST_F(RepresentationTest, AlgebraUsesCommonRepresentation) {
+  const auto area = MeterF(2.0f) * MeterF(3.0f);
+  static_assert(std::is_same_v<decltype(area)::rep, float>);
+  EXPECT_FLOAT_EQ(area.to<SquareMeter>().value(), 6.0f);
+
+  const auto speed = Quantity<KilometerTag, int32_t>(90) / Quantity<HourTag, int32_t>(1);
+  EXPECT_EQ(speed.value(), 90);
+  EXPECT_EQ(MeterI32(7) / MeterI32(2), 3);
+}
+
+TEST_F(RepresentationTest, FloatColumnsAreHalfSize) {
+  std::vector<MeterF> readings(1000, MeterF(2.5f));
+  EXPECT_EQ(readings.size() * sizeof(readings[0]), readings.size() * sizeof(float));
+  EXPECT_FLOAT_EQ(readings[999].value(), 2.5f);
+}
+
+TEST_F(RepresentationTest, StreamAndConverter) {
+  std::ostringstream os;
+  os << Quantity<MeterTag, int8_t>(42);
+  EXPECT_EQ(os.str(), "42 m");
+
+  constexpr Converter<Kilometer, Meter> km_to_m;
+  const MeterF m = km_to_m(KilometerF(1.5f));
+  EXPECT_FLOAT_EQ(m.value(), 1500.0f);
+}
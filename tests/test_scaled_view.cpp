@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Chained views fold into one factor from the original source unit.
+using KmAsAu = decltype(views::as<AstronomicalUnit>(
+    views::as<Meter>(std::declval<const QuantityArray<KilometerTag> &>())));
+static_assert(std::is_same_v<KmAsAu, ScaledView<KilometerTag, AstronomicalUnitTag>>);
+static_assert(KmAsAu::factor == conversion_factor_v<KilometerTag, AstronomicalUnitTag>);
+static_assert(ScaledView<MeterTag, MeterTag>::factor == 1.0);
+
+// Views over temporary containers would dangle, so they do not compile.
+template <typename Source, typename = void> struct ViewableAsMeter : std::false_type {};
+template <typename Source>
+struct ViewableAsMeter<Source, std::void_t<decltype(views::as<Meter>(std::declval<Source>()))>>
+    : std::true_type {};
+static_assert(ViewableAsMeter<const QuantityArray<KilometerTag> &>::value);
+static_assert(ViewableAsMeter<const std::vector<Kilometer> &>::value);
+static_assert(ViewableAsMeter<QuantitySpan<KilometerTag>>::value);
+static_assert(!ViewableAsMeter<QuantityArray<KilometerTag>>::value);
+static_assert(!ViewableAsMeter<std::vector<Kilometer>>::value);
+
+TEST_F(ScaledViewTest, ElementsAreScaledOnRead) {
+  QuantityArray<KilometerTag> km{Kilometer(1.0), Kilometer(2.5)};
+  auto m = views::as<Meter>(km);
+  ASSERT_EQ(m.size(), 2u);
+  EXPECT_EQ(m[1], Meter(2500.0));
+  EXPECT_EQ(m.source().data(), km.span().data());
+
+  // The view observes later writes to its source.
+  km.set(0, Kilometer(3.0));
+  EXPECT_EQ(m[0], Meter(3000.0));
+
+  std::vector<Meter> copied(m.begin(), m.end());
+  EXPECT_EQ(copied, (std::vector<Meter>{Meter(3000.0), Meter(2500.0)}));
+  EXPECT_EQ(std::count_if(m.begin(), m.end(), [](Meter v) { return v > Meter(2600.0); }), 1);
+}
+
+TEST_F(ScaledViewTest, ChainedViewsCompose) {
+  const std::vector<Kilometer> km{Kilometer(149597870.7), Kilometer(299195741.4)};
+  auto au = views::as<AstronomicalUnit>(views::as<Meter>(km));
+  EXPECT_NEAR(au[0].value(), 1.0, 1e-12);
+  EXPECT_NEAR(au[1].value(), 2.0, 1e-12);
+
+  // Viewing back into the source unit is the identity.
+  auto back = views::as<Kilometer>(au);
+  EXPECT_EQ(back[1], km[1]);
+}
+
+TEST_F(ScaledViewTest, Reductions) {
+  std::vector<double> raw{2.0, -1.0, 4.5};
+  auto min = views::as<MinuteTag>(ConstQuantitySpan<HourTag>(raw.data(), raw.size()));
+  EXPECT_EQ(sum(min), Minute(330.0));
+  EXPECT_EQ(qtty::min(min), Minute(-60.0));
+  EXPECT_EQ(qtty::max(min), Minute(270.0));
+
+  // Integer values are summed exactly and scaled once.
+  std::vector<int> mm{1, 1, 1};
+  auto cm = views::as<CentimeterTag>(QuantitySpan<MillimeterTag, int>(mm.data(), mm.size()));
+  EXPECT_EQ(sum(cm).value(), 0);
+  EXPECT_EQ(qtty::max(cm).value(), 0);
+  auto um = views::as<MicrometerTag>(cm);
+  EXPECT_EQ(sum(um).value(), 3000);
+}
+
+TEST_F(ScaledViewTest, CopiesInOnePass) {
+  QuantityArray<KilometerTag> km{Kilometer(1.0), Kilometer(2.0)};
+  auto m = views::as<Meter>(km);
+
+  QuantityArray<MeterTag> materialized = m.to_array();
+  EXPECT_EQ(materialized[1], Meter(2000.0));
+
+  std::vector<double> cm(km.size());
+  convert_batch(m, QuantitySpan<CentimeterTag>(cm.data(), cm.size()));
+  EXPECT_EQ(cm, (std::vector<double>{100000.0, 200000.0}));
+
+  std::vector<double> too_small(1);
+  EXPECT_THROW(convert_batch(m, QuantitySpan<MeterTag>(too_small.data(), too_small.size())),
+               QttyException);
+}
+
+#if __cplusplus >= 202002L
+static_assert(std::ranges::random_access_range<ScaledView<KilometerTag, MeterTag>>);
+static_assert(std::ranges::borrowed_range<ConstQuantitySpan<MeterTag>>);
+static_assert(std::ranges::view<ScaledView<KilometerTag, MeterTag>>);
+
+TEST_F(RangeAdaptorTest, ConvertsInsidePipelines) {
+  const std::vector<Meter> m{Meter(500.0), Meter(-1.0), Meter(2500.0)};
+  auto km = m | std::views::filter([](Meter v) { return v > Meter(0.0); }) |
+            views::convert<Kilometer>;
+  static_assert(std::is_same_v<std::ranges::range_value_t<decltype(km)>, Kilometer>);
+  std::vector<Kilometer> out(km.begin(), km.end());
+  EXPECT_EQ(out, (std::vector<Kilometer>{Kilometer(0.5), Kilometer(2.5)}));
+
+  // Rvalue spans and scaled views are views, so they can start a pipeline.
+  auto cm = views::as<Centimeter>(m) | views::convert<Millimeter> | std::views::take(1);
+  EXPECT_EQ(*cm.begin(), Millimeter(500000.0));
+}
+
+TEST_F(RangeAdaptorTest, ProjectsAndLiftsValues) {
+  const std::vector<double> raw{1.0, 2.0};
+  auto seconds = raw | views::tag<Second>;
+  EXPECT_EQ(seconds[1], Second(2.0));
+
+  auto round_trip = raw | views::tag<HourTag> | views::convert<Minute> | views::values;
+  EXPECT_EQ(std::vector<double>(round_trip.begin(), round_trip.end()),
+            (std::vector<double>{60.0, 120.0}));
+
+  // Chained adaptors fuse into one transform.
+  auto fused = views::tag<HourTag> | views::convert<Minute> | views::values;
+  auto minutes = raw | fused;
+  static_assert(std::is_same_v<decltype(minutes.base()),
+                               std::ranges::ref_view<const std::vector<double>>>);
+  EXPECT_EQ(minutes[0], 60.0);
+
+  const std::vector<float> f{1.5f};
+  static_assert(std::is_same_v<std::ranges::range_value_t<decltype(f | views::tag<Meter>)>,
+                               Quantity<MeterTag, float>>);
+}
+#endif
@@ -34,3 +34,177 @@ TEST_F(SerializationTest, JsonWithUnitIdAutoConvert) {
 TEST_F(SerializationTest, ValueOnlyRejectsInvalidJson) {
   EXPECT_THROW((serialization::from_json_value<Meter>("not a number")), ConversionError);
 }
+
+TEST_F(SerializationTest, NonThrowingVariants) {
+  auto json = serialization::try_to_json(Kilometer(2.0));
+  ASSERT_TRUE(json);
+  EXPECT_EQ(*json, serialization::to_json(Kilometer(2.0)));
+
+  auto m = serialization::try_from_json<Meter>(*json);
+  ASSERT_TRUE(m);
+  EXPECT_NEAR(m->value(), 2000.0, 1e-12);
+
+  auto bad = serialization::try_from_json_value<Meter>("not a number");
+  EXPECT_FALSE(bad);
+  EXPECT_NE(bad.status(), QTTY_STATUS_OK);
+
+  // An unknown unit is reported, also when debug builds cross-check qtty-ffi
+  auto unknown = serialization::try_from_json<Meter>(R"({"value":1,"unit_id":99999})");
+  EXPECT_EQ(unknown.status(), QTTY_STATUS_UNKNOWN_UNIT);
+}
+
+TEST_F(SerializationTest, NativeValueMatchesSerde) {
+  // Reference strings produced by serde_json::to_string(&f64)
+  const std::pair<double, const char *> cases[] = {
+      {0.0, "0.0"},
+      {-0.0, "-0.0"},
+      {42.5, "42.5"},
+      {1e15, "1000000000000000.0"},
+      {1e16, "1e16"},
+      {1.496e11, "149600000000.0"},
+      {3.085677581e16, "3.085677581e16"},
+      {1e-5, "0.00001"},
+      {1e-7, "1e-7"},
+      {2.0 / 3.0, "0.6666666666666666"},
+      {-2.5e-10, "-2.5e-10"},
+      {5e-324, "5e-324"},
+      {1.7976931348623157e308, "1.7976931348623157e308"},
+      {std::nan(""), "null"},
+  };
+  for (const auto &[value, expected] : cases) {
+    EXPECT_EQ(serialization::to_json_value(Meter(value)), expected);
+    if (std::isfinite(value)) {
+      EXPECT_EQ(serialization::from_json_value<Meter>(expected).value(), value);
+    }
+  }
+
+  const std::string id =
+      std::to_string(static_cast<std::uint32_t>(UnitTraits<MeterTag>::unit_id()));
+  EXPECT_EQ(serialization::to_json(Meter(1e16)), "{\"value\":1e16,\"unit_id\":" + id + "}");
+}
+
+TEST_F(SerializationTest, WritesIntoCallerBuffer) {
+  const Kilometer longest(-1.2345678901234567e-308);
+  char buffer[serialization::kMaxJsonSize];
+  const std::size_t n = serialization::to_json(longest, buffer, sizeof(buffer));
+  EXPECT_EQ(std::string_view(buffer, n), serialization::to_json(longest));
+
+  auto too_small = serialization::try_to_json_value(Meter(42.5), buffer, 3);
+  EXPECT_EQ(too_small.status(), QTTY_STATUS_BUFFER_TOO_SMALL);
+  EXPECT_THROW(serialization::to_json(Meter(42.5), buffer, 3), QttyException);
+}
+
+TEST_F(SerializationTest, NativeParsingAcceptsCanonicalForms) {
+  const std::string id =
+      std::to_string(static_cast<std::uint32_t>(UnitTraits<KilometerTag>::unit_id()));
+  const std::string reordered = " { \"unit_id\" : " + id + " ,\n\"value\":\t2.5e0 } ";
+  EXPECT_EQ(serialization::from_json<Kilometer>(reordered).value(), 2.5);
+  EXPECT_DOUBLE_EQ(serialization::from_json<Meter>(reordered).value(), 2500.0);
+  EXPECT_EQ(serialization::from_json_value<Meter>("  -0.125 ").value(), -0.125);
+
+  // Not JSON numbers, even though std::from_chars would take them
+  for (const char *bad : {".5", "01", "inf", "1e", "--1", "+1", "1 2"}) {
+    EXPECT_FALSE(serialization::try_from_json_value<Meter>(bad)) << bad;
+  }
+}
+
+TEST_F(SerializationTest, ParsesFieldsInPlace) {
+  const std::string id =
+      std::to_string(static_cast<std::uint32_t>(UnitTraits<KilometerTag>::unit_id()));
+  // Fields back to back, no NUL after any of them
+  const std::string buffer = "1.5" "{\"value\":2.0,\"unit_id\":" + id + "}" "7";
+  const char *data = buffer.data();
+  EXPECT_EQ(serialization::from_json_value<Meter>(data, 3).value(), 1.5);
+  const std::size_t object = buffer.size() - 4;
+  EXPECT_DOUBLE_EQ(serialization::from_json<Meter>(data + 3, object).value(), 2000.0);
+  EXPECT_EQ(serialization::from_json_value<Second>(data + 3 + object, 1).value(), 7.0);
+
+  // Non-canonical input takes the FFI path through a terminated copy
+  EXPECT_FALSE(serialization::try_from_json_value<Meter>(data, 2 + object));
+}
+
+TEST_F(SerializationTest, JsonArrayRoundTrip) {
+  const QuantityArray<KilometerTag> distances = {Kilometer(1.5), Kilometer(-0.001),
+                                                 Kilometer(1e21), Kilometer(0.1)};
+  const std::string id =
+      std::to_string(static_cast<std::uint32_t>(UnitTraits<KilometerTag>::unit_id()));
+  const std::string json = serialization::to_json_array(distances.span());
+  EXPECT_EQ(json, "{\"unit_id\":" + id + ",\"values\":[1.5,-0.001,1e21,0.1]}");
+
+  const auto parsed = serialization::from_json_array<Kilometer>(json);
+  ASSERT_EQ(parsed.size(), distances.size());
+  for (std::size_t i = 0; i < parsed.size(); ++i) {
+    EXPECT_EQ(parsed[i].value(), distances[i].value());
+  }
+
+  // Converted on the way in, and appended to an existing buffer
+  const auto meters = serialization::from_json_array<Meter>(json.data(), json.size());
+  EXPECT_DOUBLE_EQ(meters[0].value(), 1500.0);
+  EXPECT_DOUBLE_EQ(meters[3].value(), 100.0);
+  std::vector<char> out = {'x'};
+  serialization::to_json_array(QuantityArray<MeterTag>().span(), out);
+  EXPECT_EQ(std::string(out.begin(), out.end()),
+            "x{\"unit_id\":" +
+                std::to_string(static_cast<std::uint32_t>(UnitTraits<MeterTag>::unit_id())) +
+                ",\"values\":[]}");
+}
+
+TEST_F(SerializationTest, JsonArrayAcceptsMixedUnits) {
+  const std::string km =
+      std::to_string(static_cast<std::uint32_t>(UnitTraits<KilometerTag>::unit_id()));
+  const std::string m =
+      std::to_string(static_cast<std::uint32_t>(UnitTraits<MeterTag>::unit_id()));
+  const std::string json = "[{\"value\":1.0,\"unit_id\":" + km + "}, {\"unit_id\":" + m +
+                           ",\"value\":2.0}, {\"value\":0.5,\"unit_id\":" + km + "}]";
+  const auto meters = serialization::from_json_array<Meter>(json);
+  ASSERT_EQ(meters.size(), 3u);
+  EXPECT_DOUBLE_EQ(meters[0].value(), 1000.0);
+  EXPECT_DOUBLE_EQ(meters[1].value(), 2.0);
+  EXPECT_DOUBLE_EQ(meters[2].value(), 500.0);
+
+  const auto plain = serialization::from_json_array<Quantity<MeterTag, float>>(" [ 1, 2.5 ] ");
+  ASSERT_EQ(plain.size(), 2u);
+  EXPECT_EQ(plain[1].value(), 2.5f);
+  EXPECT_TRUE(serialization::from_json_array<Meter>("[]").empty());
+
+  const std::string seconds =
+      std::to_string(static_cast<std::uint32_t>(UnitTraits<SecondTag>::unit_id()));
+  EXPECT_EQ(serialization::try_from_json_array<Meter>("{\"unit_id\":" + seconds +
+                                                      ",\"values\":[1]}")
+                .status(),
+            QTTY_STATUS_INCOMPATIBLE_DIM);
+  EXPECT_EQ(serialization::try_from_json_array<Meter>("[{\"value\":1.0,\"unit_id\":" + km +
+                                                      "}, {\"value\":1,\"unit_id\":99999}]")
+                .status(),
+            QTTY_STATUS_UNKNOWN_UNIT);
+  for (const char *bad : {"", "[1,]", "[1", "{\"values\":[1]}", "[1] x", "{\"unit_id\":1}"}) {
+    EXPECT_FALSE(serialization::try_from_json_array<Meter>(bad)) << bad;
+  }
+  EXPECT_THROW(serialization::from_json_array<Meter>("[1,"), QttyException);
+}
+
+TEST_F(SerializationTest, FfiStringKeepsTheFfiBuffer) {
+  using MeterPerSecond = Quantity<CompoundTag<MeterTag, SecondTag>>;
+  static_assert(!std::is_copy_constructible_v<FfiString>);
+
+  const MeterPerSecond speed(12.5);
+  FfiString json = derived_serialization::to_ffi_json(speed);
+  ASSERT_FALSE(json.empty());
+  EXPECT_EQ(json.view(), derived_serialization::to_json(speed));
+  EXPECT_EQ(json.c_str()[json.size()], '\0');
+  EXPECT_DOUBLE_EQ(derived_serialization::from_json<MeterPerSecond>(json).value(), 12.5);
+
+  const char *data = json.data();
+  FfiString moved(std::move(json));
+  EXPECT_EQ(moved.data(), data);
+  FfiString assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.data(), data);
+  EXPECT_EQ(moved.size(), 0u);
+  EXPECT_STREQ(moved.c_str(), "");
+
+  char *raw = assigned.release();
+  EXPECT_EQ(raw, data);
+  EXPECT_TRUE(assigned.empty());
+  qtty_string_free(raw);
+}
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+std::vector<simd::SimdLevel> supported_levels() {
+  std::vector<simd::SimdLevel> levels;
+  const simd::SimdLevel best = simd::detect_level();
+  for (int level = 0; level <= static_cast<int>(best); ++level) {
+    levels.push_back(static_cast<simd::SimdLevel>(level));
+  }
+  return levels;
+}
+
+// Every kernel must match the scalar kernel bit for bit for all head/tail
+// shapes: misaligned input and output pointers and lengths around the
+// vector widths.
+template <typename T, typename Kernel, typename Reference>
+void expect_matches_scalar(Kernel kernel, Reference reference) {
+  constexpr std::size_t kMaxLength = 70;
+  constexpr std::size_t kMaxShift = 16;
+  std::vector<T> in(kMaxLength + kMaxShift);
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    in[i] = static_cast<T>(1.0 + 0.37 * static_cast<double>(i)) * (i % 2 == 0 ? T(1) : T(-1));
+  }
+  std::vector<T> expected(kMaxLength + kMaxShift);
+  std::vector<T> actual(kMaxLength + kMaxShift);
+
+  for (std::size_t in_shift = 0; in_shift < 4; ++in_shift) {
+    for (std::size_t out_shift = 0; out_shift < kMaxShift; ++out_shift) {
+      for (std::size_t n = 0; n <= kMaxLength; ++n) {
+        std::fill(expected.begin(), expected.end(), T(-7));
+        std::fill(actual.begin(), actual.end(), T(-7));
+        reference(in.data() + in_shift, expected.data() + out_shift, n);
+        kernel(in.data() + in_shift, actual.data() + out_shift, n);
+        ASSERT_EQ(std::memcmp(expected.data(), actual.data(), actual.size() * sizeof(T)), 0)
+            << "in_shift=" << in_shift << " out_shift=" << out_shift << " n=" << n;
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST_F(SimdKernelTest, ActiveLevelIsSupported) {
+  EXPECT_LE(static_cast<int>(simd::active_level()), static_cast<int>(simd::detect_level()));
+  EXPECT_EQ(simd::active_level(), simd::active_level());
+  EXPECT_STRNE(simd::to_string(simd::active_level()), "");
+}
+
+TEST_F(SimdKernelTest, ScaleMatchesScalar) {
+  for (simd::SimdLevel level : supported_levels()) {
+    SCOPED_TRACE(simd::to_string(level));
+    const simd::KernelTable table = simd::kernel_table(level);
+    EXPECT_EQ(table.level, level);
+    expect_matches_scalar<double>(
+        [&](const double *in, double *out, std::size_t n) { table.scale_f64(in, out, n, 1e-3); },
+        [](const double *in, double *out, std::size_t n) {
+          simd::kernels::scale_f64_scalar(in, out, n, 1e-3);
+        });
+    expect_matches_scalar<float>(
+        [&](const float *in, float *out, std::size_t n) { table.scale_f32(in, out, n, 2.54e-2f); },
+        [](const float *in, float *out, std::size_t n) {
+          simd::kernels::scale_f32_scalar(in, out, n, 2.54e-2f);
+        });
+  }
+}
+
+TEST_F(SimdKernelTest, AffineMatchesScalar) {
+  for (simd::SimdLevel level : supported_levels()) {
+    SCOPED_TRACE(simd::to_string(level));
+    const simd::KernelTable table = simd::kernel_table(level);
+    expect_matches_scalar<double>(
+        [&](const double *in, double *out, std::size_t n) {
+          table.affine_f64(in, out, n, 1.8, 32.0);
+        },
+        [](const double *in, double *out, std::size_t n) {
+          simd::kernels::affine_f64_scalar(in, out, n, 1.8, 32.0);
+        });
+    expect_matches_scalar<float>(
+        [&](const float *in, float *out, std::size_t n) {
+          table.affine_f32(in, out, n, 1.8f, 273.15f);
+        },
+        [](const float *in, float *out, std::size_t n) {
+          simd::kernels::affine_f32_scalar(in, out, n, 1.8f, 273.15f);
+        });
+  }
+}
+
+TEST_F(SimdKernelTest, InPlace) {
+  std::vector<double> values(45);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<double>(i);
+  }
+  simd::affine(values.data() + 1, values.data() + 1, values.size() - 1, 2.0, 1.0);
+  EXPECT_EQ(values[0], 0.0);
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    EXPECT_EQ(values[i], 2.0 * static_cast<double>(i) + 1.0);
+  }
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+// Conversions between generated units fold to a single constexpr multiply.
+static_assert(Kilometer(1.5).to<Meter>().value() == 1500.0);
+static_assert(has_static_conversion<KilometerTag, AstronomicalUnitTag>());
+static_assert(!has_static_conversion<MeterTag, SecondTag>());
+static_assert(noexcept(std::declval<const Meter &>().to<Kilometer>()));
+
+// Mixing dimensions is rejected at compile time for tags that declare one.
+static_assert(dimensions_compatible<MeterTag, ParsecTag>());
+static_assert(!dimensions_compatible<MeterTag, SecondTag>());
+static_assert(!dimensions_compatible<CompoundTag<MeterTag, SecondTag>,
+                                     CompoundTag<SecondTag, MeterTag>>());
+static_assert(has_static_dimensions<CompoundTag<MeterTag, SecondTag>,
+                                    CompoundTag<KilometerTag, HourTag>>());
+static_assert(noexcept(std::declval<const MeterPerSecond &>().to<KilometerPerHour>()));
+
+// A declared dimension without a factor still converts through qtty-ffi,
+// which can fail, so that conversion may throw.
+struct DimensionOnlyFootTag {};
+namespace qtty {
+template <> struct UnitTraits<DimensionOnlyFootTag> {
+  using dimension = dim::Length;
+  static constexpr UnitId unit_id() { return UNIT_ID_FOOT; }
+  static constexpr std::string_view symbol() { return "ft"; }
+};
+} // namespace qtty
+static_assert(has_static_dimensions<DimensionOnlyFootTag, MeterTag>());
+static_assert(!has_static_conversion<DimensionOnlyFootTag, MeterTag>());
+static_assert(!noexcept(std::declval<const Quantity<DimensionOnlyFootTag> &>().to<Meter>()));
+
+// S10 is not a per-steradian unit, so the generated header leaves it without
+// a factor and its conversions go through qtty-ffi.
+static_assert(!has_si_factor_v<S10Tag>);
+
+// Compound conversions fold to (N → N2) / (D → D2).
+static_assert(has_static_conversion<CompoundTag<KilometerTag, SecondTag>,
+                                    CompoundTag<MeterTag, SecondTag>>());
+static_assert(!has_static_conversion<CompoundTag<MeterTag, SecondTag>, MeterTag>());
+static_assert(MeterPerSecond(10.0).to<KilometerPerHour>().value() == 36.0);
+
+// Exactly defined units fold their rational chain and round once.
+static_assert(has_exact_conversion<MileTag, InchTag>());
+static_assert(!has_exact_conversion<ParsecTag, MeterTag>());
+static_assert(conversion_factor_v<MileTag, InchTag> == 63360.0);
+static_assert(conversion_factor_v<FootTag, InchTag> == 12.0);
+static_assert(conversion_factor_v<FortnightTag, SecondTag> == 1209600.0);
+static_assert(conversion_factor_v<JulianCenturyTag, DayTag> == 36525.0);
+static_assert(conversion_factor_v<CubicFootTag, CubicInchTag> == 1728.0);
+static_assert(conversion_factor_v<AcreTag, SquareFootTag> == 43560.0);
+static_assert(conversion_factor_v<LightYearTag, AttometerTag> == 9460730472580800e18);
+static_assert(conversion_factor_v<CompoundTag<FootTag, SecondTag>,
+                                  CompoundTag<InchTag, MinuteTag>> == 720.0);
+
+namespace {
+
+// Reference result computed by the Rust side.
+double ffi_convert(double value, UnitId from, UnitId to) {
+  qtty_quantity_t src{};
+  qtty_quantity_t dst{};
+  check_status(qtty_quantity_make(value, from, &src), "make");
+  check_status(qtty_quantity_convert(src, to, &dst), "convert");
+  return dst.value;
+}
+
+template <typename From, typename To> void expect_matches_ffi(double value) {
+  const double expected = ffi_convert(value, From::unit_id(), To::unit_id());
+  EXPECT_DOUBLE_EQ(From(value).template to<To>().value(), expected);
+}
+
+} // namespace
+
+TEST_F(StaticConversionTest, MatchesFfiAcrossDimensions) {
+  expect_matches_ffi<Kilometer, AstronomicalUnit>(1.0e9);
+  expect_matches_ffi<Parsec, LightYear>(1.0);
+  expect_matches_ffi<Mile, Centimeter>(3.5);
+  expect_matches_ffi<JulianCentury, Day>(1.0);
+  expect_matches_ffi<Degree, Arcsecond>(0.25);
+  expect_matches_ffi<Pound, Gram>(2.0);
+  expect_matches_ffi<Bar, PoundPerSquareInch>(1.0);
+  expect_matches_ffi<Steradian, SquareDegree>(1.0);
+  expect_matches_ffi<Rankine, Kelvin>(491.67);
+  expect_matches_ffi<KilowattHour, Electronvolt>(1.0);
+}
+
+TEST_F(StaticConversionTest, CompoundMatchesFfi) {
+  const auto ffi_derived = [](double value, UnitId n, UnitId d, UnitId n2, UnitId d2) {
+    qtty_derived_quantity_t src;
+    qtty_derived_quantity_t dst;
+    check_status(qtty_derived_make(value, n, d, &src), "make");
+    check_status(qtty_derived_convert(src, n2, d2, &dst), "convert");
+    return dst.value;
+  };
+  EXPECT_DOUBLE_EQ(KilometerPerSecond(7.8).to<MeterPerSecond>().value(),
+                   ffi_derived(7.8, UNIT_ID_KILOMETER, UNIT_ID_SECOND, UNIT_ID_METER,
+                               UNIT_ID_SECOND));
+  EXPECT_DOUBLE_EQ(MeterPerSecond(10.0).to<KilometerPerHour>().value(),
+                   ffi_derived(10.0, UNIT_ID_METER, UNIT_ID_SECOND, UNIT_ID_KILOMETER,
+                               UNIT_ID_HOUR));
+  using AuPerDay = Velocity<AstronomicalUnit, Day>;
+  EXPECT_DOUBLE_EQ(AuPerDay(1.0).to<KilometerPerSecond>().value(),
+                   ffi_derived(1.0, UNIT_ID_ASTRONOMICAL_UNIT, UNIT_ID_DAY, UNIT_ID_KILOMETER,
+                               UNIT_ID_SECOND));
+}
+
+TEST_F(StaticConversionTest, IdentityConversionIsExact) {
+  const Meter m(0.1);
+  EXPECT_EQ(m.to<Meter>().value(), 0.1);
+}
+
+TEST_F(StaticConversionTest, IncompatibleDimensionsRejectedAtCompileTime) {
+  // Meter(1.0).to<Second>() no longer compiles; runtime unit ids are still
+  // validated by the FFI.
+  EXPECT_THROW(convert_value(1.0, UNIT_ID_METER, UNIT_ID_SECOND), IncompatibleDimensionsError);
+}
+
+TEST_F(StaticConversionTest, ExactFactorsAreCorrectlyRounded) {
+  // Nearest doubles to the exact rationals, independent of the SI factors
+  EXPECT_EQ((conversion_factor_v<NanometerTag, InchTag>), 1.0 / 25400000.0);
+  EXPECT_EQ((conversion_factor_v<MileTag, KilometerTag>), 1.609344);
+  EXPECT_EQ((conversion_factor_v<UsGallonTag, UsFluidOunceTag>), 128.0);
+  EXPECT_EQ((conversion_factor_v<YearTag, DayTag>), 365.2425);
+  EXPECT_EQ(Mile(1.0).to<Inch>().value(), 63360.0);
+}
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+#include <string>
+#include <utility>
+
+static_assert(noexcept(std::declval<const Meter &>().try_to<Kilometer>()),
+              "try_to<>() must never throw");
+static_assert(noexcept(try_convert_value(1.0, UNIT_ID_METER, UNIT_ID_KILOMETER)),
+              "try_convert_value() must never throw");
+
+TEST_F(NonThrowingTest, StaticConversionSucceeds) {
+  auto km = Meter(1500.0).try_to<Kilometer>();
+  ASSERT_TRUE(km.has_value());
+  EXPECT_EQ(km.status(), QTTY_STATUS_OK);
+  EXPECT_DOUBLE_EQ(km->value(), 1.5);
+  EXPECT_DOUBLE_EQ(km.value().value(), 1.5);
+}
+
+TEST_F(NonThrowingTest, CompoundConversionSucceeds) {
+  auto kmh = MeterPerSecond(10.0).try_to<KilometerPerHour>();
+  ASSERT_TRUE(kmh);
+  EXPECT_NEAR((*kmh).value(), 36.0, 1e-12);
+}
+
+TEST_F(NonThrowingTest, RuntimeConversionMatchesThrowingPath) {
+  auto miles = try_convert_value(1.0, UNIT_ID_KILOMETER, UNIT_ID_MILE);
+  ASSERT_TRUE(miles);
+  EXPECT_EQ(*miles, convert_value(1.0, UNIT_ID_KILOMETER, UNIT_ID_MILE));
+}
+
+TEST_F(NonThrowingTest, FailureCarriesStatus) {
+  auto bad = try_convert_value(1.0, UNIT_ID_METER, UNIT_ID_SECOND);
+  EXPECT_FALSE(bad.has_value());
+  EXPECT_FALSE(static_cast<bool>(bad));
+  EXPECT_EQ(bad.status(), QTTY_STATUS_INCOMPATIBLE_DIM);
+  EXPECT_STREQ(status_message(bad.status()), "incompatible dimensions");
+  EXPECT_EQ(bad.value_or(-1.0), -1.0);
+  EXPECT_THROW(bad.value(), IncompatibleDimensionsError);
+}
+
+TEST_F(NonThrowingTest, TryFormatMatchesFormat) {
+  const Meter m(1234.56789);
+  auto text = m.try_format(2);
+  ASSERT_TRUE(text);
+  EXPECT_EQ(*text, m.format(2));
+  EXPECT_EQ(Meter(1.0).try_format().value_or(std::string()), Meter(1.0).format());
+}
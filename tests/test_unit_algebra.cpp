@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+#include "fixtures.hpp"
+
+// Exponent vectors compose through products, quotients and powers.
+static_assert(dim::Force::exponents + dim::Length::exponents == dim::Energy::exponents);
+static_assert(si_exponents_v<ProductTag<WattTag, SecondTag>> == dim::Energy::exponents);
+static_assert(si_exponents_v<PowerTag<MeterTag, 3>> == dim::Volume::exponents);
+static_assert(si_exponents_v<CompoundTag<MeterTag, SecondTag>> !=
+              si_exponents_v<CompoundTag<SecondTag, MeterTag>>);
+
+// Unit expressions convert to every unit with the same exponents.
+static_assert(has_static_conversion<ProductTag<NewtonTag, MeterTag>, JouleTag>());
+static_assert(has_static_conversion<ProductTag<KilowattTag, HourTag>, KilowattHourTag>());
+static_assert(!dimensions_compatible<ProductTag<NewtonTag, MeterTag>, WattTag>());
+static_assert((Newton(2.0) * Meter(3.0)).to<Joule>().value() == 6.0);
+static_assert((Watt(5.0) * Second(2.0)).to<Joule>().value() == 10.0);
+static_assert(pow<2>(Meter(3.0)).to<SquareMeter>().value() == 9.0);
+
+// Cancellation simplifies the result type.
+static_assert(std::is_same_v<decltype(KilometerPerHour(1.0) * Hour(1.0)), Kilometer>);
+static_assert(std::is_same_v<decltype(Hour(1.0) * KilometerPerHour(1.0)), Kilometer>);
+static_assert(std::is_same_v<decltype((Newton(1.0) * Meter(1.0)) / Meter(1.0)), Newton>);
+static_assert(std::is_same_v<decltype(Kilometer(1.0) / KilometerPerHour(1.0)), Hour>);
+static_assert(std::is_same_v<decltype(Meter(1.0) / Meter(1.0)), double>);
+static_assert(std::is_same_v<decltype(Meter(1.0) * Second(1.0)),
+                             Quantity<ProductTag<MeterTag, SecondTag>>>);
+static_assert((Meter(500.0) / Kilometer(2.0)) == 0.25);
+static_assert((KilometerPerHour(90.0) * Minute(20.0)).value() == 30.0);
+static_assert(noexcept(std::declval<const Newton &>() * std::declval<const Meter &>()));
+
+TEST_F(UnitAlgebraTest, ProductsConvertToNamedUnits) {
+  const auto work = Newton(12.5) * Meter(4.0);
+  EXPECT_DOUBLE_EQ(work.to<Joule>().value(), 50.0);
+  EXPECT_DOUBLE_EQ(work.to<Kilojoule>().value(), 0.05);
+
+  const auto energy = Kilowatt(2.0) * Hour(3.0);
+  EXPECT_DOUBLE_EQ(energy.to<KilowattHour>().value(), 6.0);
+  EXPECT_DOUBLE_EQ(energy.to<Megajoule>().value(), 21.6);
+}
+
+TEST_F(UnitAlgebraTest, QuotientsCancelAgainstDenominators) {
+  const Kilometer travelled = KilometerPerHour(120.0) * Minute(30.0);
+  EXPECT_DOUBLE_EQ(travelled.value(), 60.0);
+
+  const Hour duration = Kilometer(300.0) / KilometerPerHour(120.0);
+  EXPECT_DOUBLE_EQ(duration.value(), 2.5);
+
+  const double ratio = Meter(1500.0) / Kilometer(3.0);
+  EXPECT_DOUBLE_EQ(ratio, 0.5);
+
+  const double cycles = Hertz(50.0) * Second(2.0);
+  EXPECT_DOUBLE_EQ(cycles, 100.0);
+}
+
+TEST_F(UnitAlgebraTest, PowersAndMixedArithmetic) {
+  const auto area = pow<2>(Centimeter(30.0));
+  EXPECT_NEAR(area.to<SquareMeter>().value(), 0.09, 1e-15);
+  EXPECT_DOUBLE_EQ(pow<0>(Meter(7.0)), 1.0);
+
+  // A product unit mixes with its named counterpart like any other unit
+  const auto total = Newton(3.0) * Meter(2.0) + Joule(4.0);
+  EXPECT_DOUBLE_EQ(total.to<Joule>().value(), 10.0);
+  EXPECT_TRUE(Newton(1.0) * Kilometer(1.0) == Kilojoule(1.0));
+}